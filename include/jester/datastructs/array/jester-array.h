@@ -2,5 +2,9 @@
 #define JESTER_STDLIB_JESTER_ARRAY_H
 
 #include "jester/datastructs/array/jester-dynamic-array.h"
+#include "jester/datastructs/array/jester-typed-array.h"
+#include "jester/datastructs/array/jester-small-array.h"
+#include "jester/datastructs/array/jester-segmented-array.h"
+#include "jester/datastructs/array/jester-soa-array.h"
 
 #endif
\ No newline at end of file
@@ -3,8 +3,11 @@
  * @brief      Generic dynamic array implementation for the Jester stdlib.
  *
  * @details    Provides type-agnostic creation, push, get, clear, free,
- *             reserve, shrink, pop, and copy operations, somewhat
- *             similar to std::vector but implemented in plain C.
+ *             reserve, shrink, pop, and copy operations, plus bulk append,
+ *             range insert/erase, and unordered removal, somewhat
+ *             similar to std::vector but implemented in plain C. Each array
+ *             carries its own growth policy, trading reallocation count
+ *             against unused capacity.
  *
  * @copyright  GPL-3.0
  * @author     Case Presley
@@ -17,8 +20,47 @@
 //-------------------- INCLUDE FILES -------------------------┑
 #include <stdlib.h>                                        // |
 #include <stdbool.h>                                       // |
+#include "jester/memory/jester-allocator.h"                // |
 //------------------------------------------------------------┙
 
+#define JESTER_DYNAMIC_ARRAY_MIN_CAPACITY 8
+#define JESTER_DYNAMIC_ARRAY_PAGE_SIZE    4096
+
+// --- default-allocator buffers at least this large are mmap-backed on Linux ---
+#ifndef JESTER_DYNAMIC_ARRAY_HUGE_THRESHOLD
+#define JESTER_DYNAMIC_ARRAY_HUGE_THRESHOLD (1024 * 1024)
+#endif
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @enum   DynamicArrayGrowth
+ * @brief  How a dynamic array picks its new capacity when it runs out of room.
+ *
+ * @var    DynamicArrayGrowth::DYNAMIC_ARRAY_GROW_DOUBLE
+ *         Double the capacity (default). Fewest reallocations, up to 50% slack.
+ *
+ * @var    DynamicArrayGrowth::DYNAMIC_ARRAY_GROW_HALF
+ *         Grow by 1.5x. More reallocations, but freed blocks can be reused by
+ *         later growth steps and at most a third of the buffer is slack.
+ *
+ * @var    DynamicArrayGrowth::DYNAMIC_ARRAY_GROW_PAGE
+ *         Grow by 1.5x, then round the buffer up to whole pages so the slack
+ *         the allocator would hand out anyway becomes usable capacity. Suited
+ *         to large arrays.
+ *
+ * @var    DynamicArrayGrowth::DYNAMIC_ARRAY_GROW_FIXED
+ *         Grow by a fixed number of elements. Bounded slack, linear number of
+ *         reallocations; suited to arrays whose final size is roughly known.
+ */
+typedef enum DynamicArrayGrowth
+{
+    DYNAMIC_ARRAY_GROW_DOUBLE = 0,
+    DYNAMIC_ARRAY_GROW_HALF,
+    DYNAMIC_ARRAY_GROW_PAGE,
+    DYNAMIC_ARRAY_GROW_FIXED
+} DynamicArrayGrowth_t;
+
 // ---------------------------------------------------------------------------------------------------------------
 
 /**
@@ -36,6 +78,21 @@
  *
  * @var    DynamicArray::element_size
  *         Size of each element within the array in bytes.
+ *
+ * @var    DynamicArray::allocator
+ *         Allocator that owns @p data. NULL selects the global heap.
+ *
+ * @var    DynamicArray::growth
+ *         Growth policy used when the array runs out of capacity.
+ *
+ * @var    DynamicArray::growth_increment
+ *         Elements added per step under DYNAMIC_ARRAY_GROW_FIXED.
+ *
+ * @var    DynamicArray::huge_pages
+ *         Request transparent huge pages for mmap-backed storage.
+ *
+ * @var    DynamicArray::alignment
+ *         Guaranteed alignment of @p data in bytes, or 0 for the allocator default.
  */
 typedef struct DynamicArray
 {
@@ -43,6 +100,11 @@ typedef struct DynamicArray
     size_t count;
     size_t capacity;
     size_t element_size;
+    const JesterAllocator_t* allocator;
+    DynamicArrayGrowth_t growth;
+    size_t growth_increment;
+    bool huge_pages;
+    size_t alignment;
 } DynamicArray_t;
 
 // ---------------------------------------------------------------------------------------------------------------
@@ -55,7 +117,8 @@ typedef struct DynamicArray
  *          automatically when new elements are pushed beyond its current capacity.
  *
  * @param   element_size  Size of each element in bytes (usually use sizeof(T)).
- * @param   capacity      Initial number of elements to allocate space for.
+ * @param   capacity      Initial number of elements to allocate space for. A
+ *                        capacity of 0 allocates nothing until the first push.
  *
  * @return  A DynamicArray_t instance with allocated storage. If allocation fails,
  *          the returned struct will have data = NULL and capacity = 0.
@@ -67,12 +130,62 @@ struct DynamicArray create_dynamic_array(size_t element_size, size_t capacity);
 
 // ---------------------------------------------------------------------------------------------------------------
 
+/**
+ * @brief   Creates a dynamic array whose storage comes from a custom allocator.
+ *
+ * @details Behaves like create_dynamic_array(), but every allocation, reallocation,
+ *          and free performed on the array (including by copy_dynamic_array() for
+ *          the destination) goes through @p allocator. The allocator must outlive
+ *          the array.
+ *
+ * @param   element_size  Size of each element in bytes (usually use sizeof(T)).
+ * @param   capacity      Initial number of elements to allocate space for.
+ * @param   allocator     Allocator to use, or NULL for the global heap.
+ *
+ * @return  A DynamicArray_t instance with allocated storage. If allocation fails,
+ *          the returned struct will have data = NULL and capacity = 0.
+ *
+ * @see     create_dynamic_array(), jester_heap_allocator()
+ */
+struct DynamicArray create_dynamic_array_with_allocator(size_t element_size, size_t capacity,
+                                                        const JesterAllocator_t* allocator);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates a dynamic array whose storage is aligned to @p alignment bytes.
+ *
+ * @details Every buffer the array ever holds (after growth, shrinking, or as the
+ *          destination of copy_dynamic_array()) starts on an @p alignment
+ *          boundary, so SIMD kernels can use aligned loads on @p data and arrays
+ *          owned by different threads never share a cache line. Alignments above
+ *          what the allocator guarantees cost @p alignment extra bytes per buffer,
+ *          and growth copies instead of reallocating in place.
+ *
+ * @param   element_size  Size of each element in bytes (usually use sizeof(T)).
+ * @param   capacity      Initial number of elements to allocate space for.
+ * @param   alignment     Required alignment, a power of two (e.g. 32 or 64), or 0
+ *                        for the allocator default.
+ * @param   allocator     Allocator to use, or NULL for the global heap.
+ *
+ * @return  A DynamicArray_t instance with allocated storage. If allocation fails,
+ *          the returned struct will have data = NULL and capacity = 0. If
+ *          @p alignment is not a power of two, the returned struct is zeroed.
+ *
+ * @see     create_dynamic_array_with_allocator()
+ */
+struct DynamicArray create_dynamic_array_aligned(size_t element_size, size_t capacity, size_t alignment,
+                                                 const JesterAllocator_t* allocator);
+
+// ---------------------------------------------------------------------------------------------------------------
+
 /**
  * @brief   Pushes a new element into a dynamic array
  *
  * @details Appends an element to the end of the given DynamicArray_t.
  *          If the array is full, its internal buffer is automatically
- *          reallocated to double its current capacity before insertion.
+ *          reallocated according to the array's growth policy before insertion.
+ *          An array with no capacity grows to JESTER_DYNAMIC_ARRAY_MIN_CAPACITY.
  *
  * @param   dynamic_array  Pointer to the target DynamicArray_t.
  * @param   data           Pointer to the element data to copy into the array.
@@ -161,12 +274,14 @@ bool reserve_dynamic_array(DynamicArray_t* dynamic_array, size_t new_capacity);
  * @details Reduces the internal capacity of the given DynamicArray_t so that it
  *          matches the current element count. This function releases any unused
  *          memory beyond the number of active elements. If the array is empty,
- *          all allocated memory is freed and the array is reset to a zeroed state.
+ *          all allocated memory is freed and the capacity drops to zero; the
+ *          element size and growth policy are kept, so the array can still be
+ *          pushed to afterwards.
  *
  * @param   dynamic_array  Pointer to the target DynamicArray_t.
  *
  * @return  Returns true if the buffer was successfully shrunk or freed,
- *          or false if a memory reallocation failed.
+ *          or false if there was nothing to free or a memory reallocation failed.
  *
  * @note    Shrinking an array can help with memory usage, but may result in
  *          additional reallocations if new elements are added later.
@@ -216,4 +331,111 @@ bool copy_dynamic_array(const DynamicArray_t* dynamic_array_source, DynamicArray
 
 // ---------------------------------------------------------------------------------------------------------------
 
-#endif
+/**
+ * @brief   Appends a block of elements to the end of a dynamic array.
+ *
+ * @details Copies @p count contiguous elements from @p source onto the end of
+ *          the given DynamicArray_t. The buffer is grown at most once, to the
+ *          larger of the next growth step and the required size, and the
+ *          elements are copied with a single memcpy.
+ *
+ * @param   dynamic_array  Pointer to the target DynamicArray_t.
+ * @param   source         Pointer to @p count contiguous elements to copy.
+ * @param   count          Number of elements to append.
+ *
+ * @return  Returns true on success, or false if a memory reallocation fails.
+ */
+bool append_dynamic_array(DynamicArray_t* dynamic_array, const void* source, size_t count);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Inserts a block of elements at a position within a dynamic array.
+ *
+ * @details Shifts the elements from @p index onwards back by @p count positions
+ *          with a single memmove, then copies @p count elements from @p source
+ *          into the gap. An @p index equal to the element count appends.
+ *          The buffer is grown at most once.
+ *
+ * @param   dynamic_array  Pointer to the target DynamicArray_t.
+ * @param   index          Zero-based position of the first inserted element.
+ * @param   source         Pointer to @p count contiguous elements to copy.
+ *                         Must not point into the array itself.
+ * @param   count          Number of elements to insert.
+ *
+ * @return  Returns true on success, or false if @p index is out of range or a
+ *          memory reallocation fails.
+ */
+bool insert_dynamic_array_range(DynamicArray_t* dynamic_array, size_t index, const void* source, size_t count);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes a block of elements from a dynamic array.
+ *
+ * @details Removes the @p count elements starting at @p index and closes the
+ *          gap with a single memmove, preserving the order of the remaining
+ *          elements. The capacity is unchanged.
+ *
+ * @param   dynamic_array  Pointer to the target DynamicArray_t.
+ * @param   index          Zero-based position of the first element to remove.
+ * @param   count          Number of elements to remove.
+ *
+ * @return  Returns true on success, or false if the range is out of bounds.
+ */
+bool erase_dynamic_array_range(DynamicArray_t* dynamic_array, size_t index, size_t count);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes an element in O(1) without preserving order.
+ *
+ * @details Overwrites the element at @p index with the last element and
+ *          decrements the element count. Use this instead of
+ *          erase_dynamic_array_range() when element order does not matter.
+ *
+ * @param   dynamic_array  Pointer to the target DynamicArray_t.
+ * @param   index          Zero-based index of the element to remove.
+ *
+ * @return  Returns true on success, or false if the index is invalid.
+ */
+bool swap_remove_dynamic_array(DynamicArray_t* dynamic_array, size_t index);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Sets the growth policy of a dynamic array.
+ *
+ * @details Only affects future growth; the current buffer is left alone.
+ *          copy_dynamic_array() carries the policy over to the destination.
+ *
+ * @param   dynamic_array  Pointer to the target DynamicArray_t.
+ * @param   growth         Growth policy to use from now on.
+ * @param   increment      Elements added per step for DYNAMIC_ARRAY_GROW_FIXED,
+ *                         ignored by the other policies.
+ *
+ * @return  Returns true on success, or false if @p growth is
+ *          DYNAMIC_ARRAY_GROW_FIXED and @p increment is 0.
+ */
+bool set_dynamic_array_growth(DynamicArray_t* dynamic_array, DynamicArrayGrowth_t growth, size_t increment);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Requests transparent huge pages for the array's mapped storage.
+ *
+ * @details Arrays using the default allocator switch to anonymous mappings once
+ *          their buffer reaches JESTER_DYNAMIC_ARRAY_HUGE_THRESHOLD bytes, and
+ *          grow with mremap() from then on instead of copying through realloc.
+ *          When enabled, those mappings are advised with MADV_HUGEPAGE, which
+ *          cuts TLB misses on very large arrays. Has no effect on smaller
+ *          arrays, custom allocators, or systems without the advice.
+ *
+ * @param   dynamic_array  Pointer to the target DynamicArray_t.
+ * @param   enabled        True to request huge pages on future mappings.
+ */
+void set_dynamic_array_huge_pages(DynamicArray_t* dynamic_array, bool enabled);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+#endif
\ No newline at end of file
@@ -0,0 +1,190 @@
+﻿/**
+ * @headerfile jester-segmented-array.h
+ * @brief      Segmented array with stable element addresses for the Jester stdlib.
+ *
+ * @details    Stores elements in a table of separately allocated segments whose
+ *             sizes double (JESTER_SEGMENTED_ARRAY_FIRST_SEGMENT, then twice
+ *             that, and so on). Growing adds a segment and never copies or
+ *             moves existing elements, so pointers returned by
+ *             get_segmented_array_element() stay valid until the element is
+ *             popped or the array is cleared or freed, and push has no
+ *             reallocation latency spikes. Indexing is O(1): the segment is
+ *             found with a single count-leading-zeros instruction.
+ *
+ * @copyright  GPL-3.0
+ * @author     Case Presley
+ * @date       10-17-2026
+ */
+
+#ifndef JESTER_STDLIB_JESTER_SEGMENTED_ARRAY_H
+#define JESTER_STDLIB_JESTER_SEGMENTED_ARRAY_H
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include <stdbool.h>                                       // |
+#include <stddef.h>                                        // |
+#include "jester/memory/jester-allocator.h"                // |
+//------------------------------------------------------------┙
+
+// --- size of segment 0 in elements, a power of two ---
+#define JESTER_SEGMENTED_ARRAY_FIRST_SEGMENT 16
+
+// --- 48 doubling segments hold about 2^52 elements ---
+#define JESTER_SEGMENTED_ARRAY_MAX_SEGMENTS  48
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @struct SegmentedArray
+ * @brief  Growable array whose elements never move.
+ *
+ * @var    SegmentedArray::segments
+ *         Segment table; segment k holds JESTER_SEGMENTED_ARRAY_FIRST_SEGMENT << k elements.
+ *
+ * @var    SegmentedArray::segment_count
+ *         Number of segments allocated so far. Segments are kept until the array is freed.
+ *
+ * @var    SegmentedArray::count
+ *         Current number of elements in use.
+ *
+ * @var    SegmentedArray::element_size
+ *         Size of each element within the array in bytes.
+ *
+ * @var    SegmentedArray::allocator
+ *         Allocator the segments come from. NULL selects the global heap.
+ */
+typedef struct SegmentedArray
+{
+    void* segments[JESTER_SEGMENTED_ARRAY_MAX_SEGMENTS];
+    size_t segment_count;
+    size_t count;
+    size_t element_size;
+    const JesterAllocator_t* allocator;
+} SegmentedArray_t;
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates an empty segmented array for elements of a fixed size.
+ *
+ * @details No memory is allocated until the first push or reserve.
+ *
+ * @param   element_size  Size of each element in bytes (usually use sizeof(T)).
+ *
+ * @return  An initialized SegmentedArray_t.
+ *
+ * @note    The array MUST be freed later using free_segmented_array().
+ */
+SegmentedArray_t create_segmented_array(size_t element_size);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates an empty segmented array whose segments come from @p allocator.
+ *
+ * @param   element_size  Size of each element in bytes (usually use sizeof(T)).
+ * @param   allocator     Allocator to use, or NULL for the global heap.
+ *
+ * @return  An initialized SegmentedArray_t.
+ */
+SegmentedArray_t create_segmented_array_with_allocator(size_t element_size, const JesterAllocator_t* allocator);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Appends a copy of an element to a segmented array.
+ *
+ * @details Allocates a new segment when the last one is full. Existing elements
+ *          are never copied or moved.
+ *
+ * @param   segmented_array  Pointer to the target SegmentedArray_t.
+ * @param   data             Pointer to the element data to copy into the array.
+ *
+ * @return  Pointer to the stored element, or NULL if a segment allocation failed
+ *          or the segment table is full.
+ */
+void* push_segmented_array(SegmentedArray_t* segmented_array, const void* data);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Retrieves a pointer to an element within a segmented array.
+ *
+ * @details The returned pointer stays valid until the element is popped or the
+ *          array is cleared or freed; later pushes do not invalidate it.
+ *
+ * @param   segmented_array  Pointer to the target SegmentedArray_t.
+ * @param   index            Zero-based index of the element to retrieve.
+ *
+ * @return  Pointer to the requested element, or NULL if the index is invalid.
+ */
+void* get_segmented_array_element(const SegmentedArray_t* segmented_array, size_t index);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Retrieves a pointer to an element without reading the array's count.
+ *
+ * @details For callers that already know @p index is in range through their own
+ *          synchronization, e.g. a reader that acquired a count published after
+ *          the push while a writer keeps pushing. Only the element's own segment
+ *          pointer is read, and that never changes once the segment exists.
+ *
+ * @param   segmented_array  Pointer to the target SegmentedArray_t.
+ * @param   index            Zero-based index of an element known to be in use.
+ *
+ * @return  Pointer to the element. An out-of-range @p index is undefined behavior.
+ */
+void* get_segmented_array_element_unchecked(const SegmentedArray_t* segmented_array, size_t index);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes the last element from a segmented array.
+ *
+ * @param   segmented_array  Pointer to the target SegmentedArray_t.
+ * @param   destination      Optional buffer receiving a copy of the removed element.
+ *
+ * @return  Returns true if an element was removed, or false if the array was empty.
+ */
+bool pop_segmented_array(SegmentedArray_t* segmented_array, void* destination);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Ensures the array can hold @p capacity elements without allocating.
+ *
+ * @return  Returns true on success, or false if a segment allocation failed or
+ *          @p capacity exceeds what the segment table can address.
+ */
+bool reserve_segmented_array(SegmentedArray_t* segmented_array, size_t capacity);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the number of elements the allocated segments can hold.
+ */
+size_t get_segmented_array_capacity(const SegmentedArray_t* segmented_array);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes all elements, keeping the segments for reuse.
+ *
+ * @return  Always returns true to indicate the operation completed successfully.
+ */
+bool clear_segmented_array(SegmentedArray_t* segmented_array);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Frees every segment and resets the array to an empty state.
+ *
+ * @details The element size and allocator are kept, so the array can be reused.
+ *
+ * @return  Returns true if memory was freed, or false if no segments were allocated.
+ */
+bool free_segmented_array(SegmentedArray_t* segmented_array);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,186 @@
+﻿/**
+ * @headerfile jester-small-array.h
+ * @brief      Small-buffer arrays generated by a macro template.
+ *
+ * @details    JESTER_DEFINE_SMALL_ARRAY(T, N, Name) generates a Name_t container
+ *             that stores its first N elements inside the struct itself and only
+ *             moves to the heap once it outgrows them. Creating one never
+ *             allocates, so arrays that usually stay small (the common case for
+ *             per-object lists) cost no malloc/free pair at all.
+ *
+ *             While the elements are inline the heap pointer is NULL rather than
+ *             pointing into the struct, so an inline Name_t can be returned and
+ *             copied by value like any plain struct. Always reach the elements
+ *             through data_Name(), which picks the live buffer.
+ *
+ *             Example:
+ *             @code
+ *             JESTER_DEFINE_SMALL_ARRAY(uint32_t, 8, EdgeList)
+ *
+ *             EdgeList_t edges = create_EdgeList();
+ *             push_EdgeList(&edges, 7);
+ *             const uint32_t* e = data_EdgeList(&edges);
+ *             for (size_t i = 0; i < edges.count; i++) visit(e[i]);
+ *             free_EdgeList(&edges);
+ *             @endcode
+ *
+ * @copyright  GPL-3.0
+ * @author     Case Presley
+ * @date       10-17-2026
+ */
+
+#ifndef JESTER_STDLIB_JESTER_SMALL_ARRAY_H
+#define JESTER_STDLIB_JESTER_SMALL_ARRAY_H
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include <stdbool.h>                                       // |
+#include <stdlib.h>                                        // |
+#include <string.h>                                        // |
+//------------------------------------------------------------┙
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @def     JESTER_DEFINE_SMALL_ARRAY(T, N, Name)
+ * @brief   Defines the Name_t small-buffer array type and its functions for element type T.
+ *
+ * @details Generated functions mirror JESTER_DEFINE_ARRAY with typed values:
+ *          - Name_t create_Name(void)                         (never allocates)
+ *          - T*     data_Name(Name_t* a)                      (inline or heap buffer)
+ *          - bool   is_inline_Name(const Name_t* a)
+ *          - bool   reserve_Name(Name_t* a, size_t new_capacity)
+ *          - bool   push_Name(Name_t* a, T value)
+ *          - T*     get_Name(Name_t* a, size_t index)         (NULL if out of range)
+ *          - bool   pop_Name(Name_t* a, T* destination)       (destination may be NULL)
+ *          - bool   clear_Name(Name_t* a)
+ *          - bool   shrink_Name(Name_t* a)                    (moves back inline when it fits)
+ *          - bool   free_Name(Name_t* a)
+ *          - bool   copy_Name(const Name_t* source, Name_t* destination)
+ *
+ *          The capacity is N while inline. The first spill allocates 2 * N elements,
+ *          after which growth doubles, and the spill path is kept out of line so
+ *          push stays a compare, a store, and an increment.
+ *
+ * @note    Use at file scope, once per element type per translation unit. N must
+ *          be at least 1. Pointers returned by data_Name()/get_Name() are
+ *          invalidated when the array grows, shrinks, or is copied by value.
+ */
+#define JESTER_DEFINE_SMALL_ARRAY(T, N, Name)                                                                          \
+    typedef struct Name                                                                                                \
+    {                                                                                                                  \
+        T* heap;                                                                                                       \
+        size_t count;                                                                                                  \
+        size_t capacity;                                                                                               \
+        T inline_data[N];                                                                                              \
+    } Name##_t;                                                                                                        \
+                                                                                                                       \
+    static inline Name##_t create_##Name(void)                                                                         \
+    {                                                                                                                  \
+        Name##_t a = {};                                                                                               \
+        a.capacity = (N);                                                                                              \
+        return a;                                                                                                      \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool is_inline_##Name(const Name##_t* a)                                                             \
+    {                                                                                                                  \
+        return a->heap == NULL;                                                                                        \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline T* data_##Name(Name##_t* a)                                                                          \
+    {                                                                                                                  \
+        return a->heap ? a->heap : a->inline_data;                                                                     \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool reserve_##Name(Name##_t* a, const size_t new_capacity)                                          \
+    {                                                                                                                  \
+        if (a->capacity >= new_capacity) return true;                                                                  \
+        if (new_capacity > (size_t)-1 / sizeof(T)) return false;                                                       \
+        if (a->heap)                                                                                                   \
+        {                                                                                                              \
+            T* temp_ptr = (T*)realloc(a->heap, sizeof(T) * new_capacity);                                              \
+            if (temp_ptr == NULL) return false;                                                                        \
+            a->heap = temp_ptr;                                                                                        \
+        }                                                                                                              \
+        else                                                                                                           \
+        {                                                                                                              \
+            T* temp_ptr = (T*)malloc(sizeof(T) * new_capacity);                                                        \
+            if (temp_ptr == NULL) return false;                                                                        \
+            memcpy(temp_ptr, a->inline_data, sizeof(T) * a->count);                                                    \
+            a->heap = temp_ptr;                                                                                        \
+        }                                                                                                              \
+        a->capacity = new_capacity;                                                                                    \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static __attribute__((noinline, unused)) bool grow_##Name(Name##_t* a)                                             \
+    {                                                                                                                  \
+        return reserve_##Name(a, a->capacity * 2);                                                                     \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool push_##Name(Name##_t* a, const T value)                                                         \
+    {                                                                                                                  \
+        if (__builtin_expect(a->count == a->capacity, 0) && !grow_##Name(a)) return false;                             \
+        data_##Name(a)[a->count++] = value;                                                                            \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline T* get_##Name(Name##_t* a, const size_t index)                                                       \
+    {                                                                                                                  \
+        return index < a->count ? &data_##Name(a)[index] : NULL;                                                       \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool pop_##Name(Name##_t* a, T* destination)                                                         \
+    {                                                                                                                  \
+        if (a->count == 0) return false;                                                                               \
+        a->count--;                                                                                                    \
+        if (destination) *destination = data_##Name(a)[a->count];                                                      \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool clear_##Name(Name##_t* a)                                                                       \
+    {                                                                                                                  \
+        a->count = 0;                                                                                                  \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool shrink_##Name(Name##_t* a)                                                                      \
+    {                                                                                                                  \
+        if (a->heap == NULL) return true;                                                                              \
+        if (a->count <= (N))                                                                                           \
+        {                                                                                                              \
+            memcpy(a->inline_data, a->heap, sizeof(T) * a->count);                                                     \
+            free(a->heap);                                                                                             \
+            a->heap     = NULL;                                                                                        \
+            a->capacity = (N);                                                                                         \
+            return true;                                                                                               \
+        }                                                                                                              \
+        T* temp_ptr = (T*)realloc(a->heap, sizeof(T) * a->count);                                                      \
+        if (temp_ptr == NULL) return false;                                                                            \
+        a->heap     = temp_ptr;                                                                                        \
+        a->capacity = a->count;                                                                                        \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool free_##Name(Name##_t* a)                                                                        \
+    {                                                                                                                  \
+        const bool had_heap = a->heap != NULL;                                                                         \
+        free(a->heap);                                                                                                 \
+        a->heap     = NULL;                                                                                            \
+        a->count    = 0;                                                                                               \
+        a->capacity = (N);                                                                                             \
+        return had_heap;                                                                                               \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool copy_##Name(const Name##_t* source, Name##_t* destination)                                      \
+    {                                                                                                                  \
+        *destination = create_##Name();                                                                                \
+        if (!reserve_##Name(destination, source->count)) return false;                                                 \
+        const T* from = source->heap ? source->heap : source->inline_data;                                             \
+        if (source->count != 0) memcpy(data_##Name(destination), from, sizeof(T) * source->count);                     \
+        destination->count = source->count;                                                                            \
+        return true;                                                                                                   \
+    }
+
+// ---------------------------------------------------------------------------------------------------------------
+
+#endif
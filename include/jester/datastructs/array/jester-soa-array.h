@@ -0,0 +1,200 @@
+﻿/**
+ * @headerfile jester-soa-array.h
+ * @brief      Structure-of-arrays container for the Jester stdlib.
+ *
+ * @details    Stores records column by column: each field gets its own
+ *             contiguous column, and all columns share one allocation and one
+ *             capacity. A loop that reads two fields of a wide record only
+ *             streams those two columns through the cache instead of every
+ *             byte of every record. Columns start on 64-byte boundaries so
+ *             they can be processed with aligned SIMD loads.
+ *
+ *             Example:
+ *             @code
+ *             enum { POS_X, POS_Y, MASS, FIELD_COUNT };
+ *             const size_t sizes[FIELD_COUNT] = {sizeof(float), sizeof(float), sizeof(double)};
+ *             SoaArray_t bodies = create_soa_array(sizes, FIELD_COUNT);
+ *
+ *             const void* fields[FIELD_COUNT] = {&x, &y, &mass};
+ *             push_soa_array(&bodies, fields);
+ *
+ *             float* xs = get_soa_array_column(&bodies, POS_X);
+ *             for (size_t i = 0; i < bodies.count; i++) xs[i] += dx;
+ *             free_soa_array(&bodies);
+ *             @endcode
+ *
+ * @copyright  GPL-3.0
+ * @author     Case Presley
+ * @date       10-17-2026
+ */
+
+#ifndef JESTER_STDLIB_JESTER_SOA_ARRAY_H
+#define JESTER_STDLIB_JESTER_SOA_ARRAY_H
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include <stdbool.h>                                       // |
+#include <stddef.h>                                        // |
+#include "jester/memory/jester-allocator.h"                // |
+//------------------------------------------------------------┙
+
+#define JESTER_SOA_ARRAY_MAX_FIELDS       16
+#define JESTER_SOA_ARRAY_MIN_CAPACITY     8
+#define JESTER_SOA_ARRAY_COLUMN_ALIGNMENT 64
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @struct SoaArray
+ * @brief  Column-oriented array of records with a fixed set of fields.
+ *
+ * @var    SoaArray::data
+ *         Start of the first column, aligned to JESTER_SOA_ARRAY_COLUMN_ALIGNMENT.
+ *
+ * @var    SoaArray::block
+ *         Raw allocation holding every column.
+ *
+ * @var    SoaArray::count
+ *         Current number of records in use.
+ *
+ * @var    SoaArray::capacity
+ *         Number of records every column can hold before the block is resized.
+ *
+ * @var    SoaArray::field_count
+ *         Number of fields (columns) per record.
+ *
+ * @var    SoaArray::field_sizes
+ *         Size of each field in bytes.
+ *
+ * @var    SoaArray::column_offsets
+ *         Byte offset of each column from @p data at the current capacity.
+ *
+ * @var    SoaArray::allocator
+ *         Allocator that owns @p block. NULL selects the global heap.
+ */
+typedef struct SoaArray
+{
+    void* data;
+    void* block;
+    size_t count;
+    size_t capacity;
+    size_t field_count;
+    size_t field_sizes[JESTER_SOA_ARRAY_MAX_FIELDS];
+    size_t column_offsets[JESTER_SOA_ARRAY_MAX_FIELDS];
+    const JesterAllocator_t* allocator;
+} SoaArray_t;
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates an empty structure-of-arrays container.
+ *
+ * @details No memory is allocated until the first push or reserve.
+ *
+ * @param   field_sizes  Size in bytes of each field, in column order.
+ * @param   field_count  Number of fields, at most JESTER_SOA_ARRAY_MAX_FIELDS.
+ *
+ * @return  An initialized SoaArray_t, or a zeroed one (field_count = 0) if
+ *          @p field_count is 0 or too large.
+ *
+ * @note    The array MUST be freed later using free_soa_array().
+ */
+SoaArray_t create_soa_array(const size_t* field_sizes, size_t field_count);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates an empty structure-of-arrays container whose block comes from @p allocator.
+ */
+SoaArray_t create_soa_array_with_allocator(const size_t* field_sizes, size_t field_count,
+                                           const JesterAllocator_t* allocator);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Ensures every column can hold at least @p new_capacity records.
+ *
+ * @details Allocates a new block and copies each column into it in one memcpy
+ *          per column.
+ *
+ * @return  Returns true on success, or false if a memory allocation fails.
+ */
+bool reserve_soa_array(SoaArray_t* soa_array, size_t new_capacity);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Appends a record, writing one value into every column.
+ *
+ * @param   soa_array  Pointer to the target SoaArray_t.
+ * @param   fields     One pointer per field to the value to copy. A NULL entry
+ *                     zero-fills that field.
+ *
+ * @return  Returns true on success, or false if a memory allocation fails.
+ */
+bool push_soa_array(SoaArray_t* soa_array, const void* const* fields);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns a raw pointer to the start of a column.
+ *
+ * @details The column holds @p count contiguous values of the field's size.
+ *          The pointer is invalidated when the array grows or is freed.
+ *
+ * @return  Pointer to the column, or NULL if @p field is out of range or
+ *          nothing has been allocated yet.
+ */
+void* get_soa_array_column(const SoaArray_t* soa_array, size_t field);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns a pointer to one field of one record.
+ *
+ * @return  Pointer to the value, or NULL if @p field or @p index is out of range.
+ */
+void* get_soa_array_field(const SoaArray_t* soa_array, size_t field, size_t index);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes a record in O(1) without preserving order.
+ *
+ * @details Moves the last record into the hole, one field per column.
+ *
+ * @return  Returns true on success, or false if the index is invalid.
+ */
+bool swap_remove_soa_array(SoaArray_t* soa_array, size_t index);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes the last record.
+ *
+ * @return  Returns true if a record was removed, or false if the array was empty.
+ */
+bool pop_soa_array(SoaArray_t* soa_array);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes all records, keeping the allocated block.
+ *
+ * @return  Always returns true to indicate the operation completed successfully.
+ */
+bool clear_soa_array(SoaArray_t* soa_array);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Frees the column block and resets the array to an empty state.
+ *
+ * @details The field layout and allocator are kept, so the array can be reused.
+ *
+ * @return  Returns true if memory was freed, or false if nothing was allocated.
+ */
+bool free_soa_array(SoaArray_t* soa_array);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+#endif
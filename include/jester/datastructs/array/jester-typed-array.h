@@ -0,0 +1,156 @@
+﻿/**
+ * @headerfile jester-typed-array.h
+ * @brief      Type-specialized dynamic arrays generated by a macro template.
+ *
+ * @details    JESTER_DEFINE_ARRAY(T, Name) generates a Name_t container holding
+ *             a T* buffer plus static inline create, push, get, pop, clear,
+ *             free, reserve, shrink, and copy functions. Unlike DynamicArray_t
+ *             the element size is known at compile time, so every access is a
+ *             direct typed load/store the compiler can inline and vectorize.
+ *
+ *             Example:
+ *             @code
+ *             JESTER_DEFINE_ARRAY(int32_t, I32Array)
+ *
+ *             I32Array_t values = create_I32Array(64);
+ *             push_I32Array(&values, 42);
+ *             for (size_t i = 0; i < values.count; i++) sum += values.data[i];
+ *             free_I32Array(&values);
+ *             @endcode
+ *
+ * @copyright  GPL-3.0
+ * @author     Case Presley
+ * @date       10-16-2026
+ */
+
+#ifndef JESTER_STDLIB_JESTER_TYPED_ARRAY_H
+#define JESTER_STDLIB_JESTER_TYPED_ARRAY_H
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include <stdbool.h>                                       // |
+#include <stdlib.h>                                        // |
+#include <string.h>                                        // |
+//------------------------------------------------------------┙
+
+#define JESTER_TYPED_ARRAY_MIN_CAPACITY 8
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @def     JESTER_DEFINE_ARRAY(T, Name)
+ * @brief   Defines the Name_t array type and its functions for element type T.
+ *
+ * @details Generated functions mirror the DynamicArray_t API with typed values:
+ *          - Name_t create_Name(size_t capacity)
+ *          - bool   reserve_Name(Name_t* a, size_t new_capacity)
+ *          - bool   push_Name(Name_t* a, T value)
+ *          - T*     get_Name(const Name_t* a, size_t index)   (NULL if out of range)
+ *          - bool   pop_Name(Name_t* a, T* destination)       (destination may be NULL)
+ *          - bool   clear_Name(Name_t* a)
+ *          - bool   shrink_Name(Name_t* a)
+ *          - bool   free_Name(Name_t* a)
+ *          - bool   copy_Name(const Name_t* source, Name_t* destination)
+ *
+ *          Hot loops may index a->data directly for unchecked access. Growth doubles
+ *          the capacity (starting at JESTER_TYPED_ARRAY_MIN_CAPACITY) and is kept out
+ *          of line so push stays a compare, a store, and an increment.
+ *
+ * @note    Use at file scope, once per element type per translation unit.
+ */
+#define JESTER_DEFINE_ARRAY(T, Name)                                                                                   \
+    typedef struct Name                                                                                                \
+    {                                                                                                                  \
+        T* data;                                                                                                       \
+        size_t count;                                                                                                  \
+        size_t capacity;                                                                                               \
+    } Name##_t;                                                                                                        \
+                                                                                                                       \
+    static inline Name##_t create_##Name(const size_t capacity)                                                        \
+    {                                                                                                                  \
+        Name##_t a = {NULL, 0, 0};                                                                                     \
+        if (capacity == 0) return a;                                                                                   \
+        a.data = (T*)malloc(sizeof(T) * capacity);                                                                     \
+        if (a.data != NULL) a.capacity = capacity;                                                                     \
+        return a;                                                                                                      \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool reserve_##Name(Name##_t* a, const size_t new_capacity)                                          \
+    {                                                                                                                  \
+        if (a->capacity >= new_capacity) return true;                                                                  \
+        T* temp_ptr = (T*)realloc(a->data, sizeof(T) * new_capacity);                                                  \
+        if (temp_ptr == NULL) return false;                                                                            \
+        a->data     = temp_ptr;                                                                                        \
+        a->capacity = new_capacity;                                                                                    \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static __attribute__((noinline, unused)) bool grow_##Name(Name##_t* a)                                             \
+    {                                                                                                                  \
+        const size_t new_capacity = a->capacity ? a->capacity * 2 : JESTER_TYPED_ARRAY_MIN_CAPACITY;                   \
+        return reserve_##Name(a, new_capacity);                                                                        \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool push_##Name(Name##_t* a, const T value)                                                         \
+    {                                                                                                                  \
+        if (__builtin_expect(a->count == a->capacity, 0) && !grow_##Name(a)) return false;                             \
+        a->data[a->count++] = value;                                                                                   \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline T* get_##Name(const Name##_t* a, const size_t index)                                                 \
+    {                                                                                                                  \
+        return index < a->count ? &a->data[index] : NULL;                                                              \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool pop_##Name(Name##_t* a, T* destination)                                                         \
+    {                                                                                                                  \
+        if (a->count == 0) return false;                                                                               \
+        a->count--;                                                                                                    \
+        if (destination) *destination = a->data[a->count];                                                             \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool clear_##Name(Name##_t* a)                                                                       \
+    {                                                                                                                  \
+        a->count = 0;                                                                                                  \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool shrink_##Name(Name##_t* a)                                                                      \
+    {                                                                                                                  \
+        if (a->count == 0)                                                                                             \
+        {                                                                                                              \
+            free(a->data);                                                                                             \
+            a->data     = NULL;                                                                                        \
+            a->capacity = 0;                                                                                           \
+            return true;                                                                                               \
+        }                                                                                                              \
+        T* temp_ptr = (T*)realloc(a->data, sizeof(T) * a->count);                                                      \
+        if (temp_ptr == NULL) return false;                                                                            \
+        a->data     = temp_ptr;                                                                                        \
+        a->capacity = a->count;                                                                                        \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool free_##Name(Name##_t* a)                                                                        \
+    {                                                                                                                  \
+        if (a->data == NULL) return false;                                                                             \
+        free(a->data);                                                                                                 \
+        a->data     = NULL;                                                                                            \
+        a->count    = 0;                                                                                               \
+        a->capacity = 0;                                                                                               \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool copy_##Name(const Name##_t* source, Name##_t* destination)                                      \
+    {                                                                                                                  \
+        *destination = create_##Name(source->capacity);                                                               \
+        if (source->capacity != 0 && destination->data == NULL) return false;                                          \
+        if (source->count != 0) memcpy(destination->data, source->data, sizeof(T) * source->count);                    \
+        destination->count = source->count;                                                                            \
+        return true;                                                                                                   \
+    }
+
+// ---------------------------------------------------------------------------------------------------------------
+
+#endif
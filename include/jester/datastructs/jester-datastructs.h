@@ -4,3 +4,5 @@
 #endif // JESTER_STDLIB_JESTER_DATASTRUCTS_H
 
 #include "jester/datastructs/array/jester-array.h"
+#include "jester/datastructs/map/jester-map.h"
+#include "jester/datastructs/queue/jester-queue.h"
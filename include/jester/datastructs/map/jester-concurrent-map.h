@@ -0,0 +1,263 @@
+﻿/**
+ * @headerfile jester-concurrent-map.h
+ * @brief      Sharded concurrent hash map with optimistic reads for the Jester stdlib.
+ *
+ * @details    Entries are split by hash across independently locked shards,
+ *             each an open-addressing table with inline keys and values.
+ *             Writers take the shard's mutex; readers take no lock at all.
+ *             Each shard carries a sequence counter (a seqlock) that writers
+ *             make odd while they modify the table and even again afterwards.
+ *             A reader copies what it needs, then checks the counter did not
+ *             move and retries if it did, so a lookup never writes shared
+ *             memory and read-mostly workloads scale with the thread count.
+ *
+ *             Tables that a shard outgrows are retired, not freed: a reader
+ *             may still be walking one. They are released by free_concurrent_map()
+ *             or, once no reader can be running, by reclaim_concurrent_map().
+ *
+ *             Values are copied out rather than returned by pointer, since a
+ *             pointer into the table could be invalidated by any writer.
+ *
+ *             Example:
+ *             @code
+ *             ConcurrentMap_t cache = create_concurrent_map(sizeof(uint64_t), sizeof(Entry_t));
+ *             insert_concurrent_map(&cache, &id, &entry);       // any thread
+ *             Entry_t found;
+ *             if (get_concurrent_map(&cache, &id, &found)) ...  // any thread, lock-free
+ *             free_concurrent_map(&cache);
+ *             @endcode
+ *
+ * @copyright  GPL-3.0
+ * @author     Case Presley
+ * @date       10-17-2026
+ */
+
+#ifndef JESTER_STDLIB_JESTER_CONCURRENT_MAP_H
+#define JESTER_STDLIB_JESTER_CONCURRENT_MAP_H
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include <pthread.h>                                       // |
+#include <stdatomic.h>                                     // |
+#include <stdbool.h>                                       // |
+#include <stddef.h>                                        // |
+#include <stdint.h>                                        // |
+#include "jester/datastructs/map/jester-hashmap.h"         // |
+#include "jester/memory/jester-allocator.h"                // |
+//------------------------------------------------------------┙
+
+#define JESTER_CONCURRENT_MAP_DEFAULT_SHARDS 64
+#define JESTER_CONCURRENT_MAP_MAX_SHARDS     1024
+#define JESTER_CONCURRENT_MAP_MIN_CAPACITY   16
+#define JESTER_CONCURRENT_MAP_MAX_KEY_SIZE   64  // keys are snapshotted before a custom equality runs
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @struct ConcurrentMapShard
+ * @brief  One independently locked table, padded to its own cache line.
+ *
+ * @var    ConcurrentMapShard::sequence
+ *         Seqlock counter, odd while a writer is modifying the table.
+ *
+ * @var    ConcurrentMapShard::lock
+ *         Mutex serializing the shard's writers.
+ *
+ * @var    ConcurrentMapShard::table
+ *         Current table, or NULL before the first insert.
+ *
+ * @var    ConcurrentMapShard::retired
+ *         Tables replaced by growth, kept alive for in-flight readers.
+ *
+ * @var    ConcurrentMapShard::count
+ *         Number of entries in the shard.
+ */
+typedef struct ConcurrentMapShard
+{
+    _Alignas(64) atomic_uint sequence;
+    pthread_mutex_t lock;
+    struct ConcurrentMapTable* _Atomic table;
+    struct ConcurrentMapTable* retired;
+    atomic_size_t count;
+} ConcurrentMapShard_t;
+
+/**
+ * @struct ConcurrentMap
+ * @brief  Sharded hash map safe for concurrent readers and writers.
+ *
+ * @var    ConcurrentMap::shards
+ *         Cache-line aligned shard array.
+ *
+ * @var    ConcurrentMap::shards_block
+ *         Unaligned allocation backing the shard array.
+ *
+ * @var    ConcurrentMap::shard_count
+ *         Number of shards, a power of two.
+ *
+ * @var    ConcurrentMap::key_size
+ *         Size of each key in bytes.
+ *
+ * @var    ConcurrentMap::value_size
+ *         Size of each value in bytes, may be 0.
+ *
+ * @var    ConcurrentMap::value_offset
+ *         Offset of the value within a slot.
+ *
+ * @var    ConcurrentMap::slot_size
+ *         Size of a slot in bytes.
+ *
+ * @var    ConcurrentMap::hash
+ *         Hash function applied to keys.
+ *
+ * @var    ConcurrentMap::equals
+ *         Key equality function.
+ *
+ * @var    ConcurrentMap::allocator
+ *         Allocator that owns the shards and tables. NULL selects the global heap.
+ */
+typedef struct ConcurrentMap
+{
+    ConcurrentMapShard_t* shards;
+    void* shards_block;
+    size_t shard_count;
+    size_t key_size;
+    size_t value_size;
+    size_t value_offset;
+    size_t slot_size;
+    JesterHashFn hash;
+    JesterEqualsFn equals;
+    const JesterAllocator_t* allocator;
+} ConcurrentMap_t;
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates an empty concurrent map comparing keys as raw bytes.
+ *
+ * @param   key_size    Size of each key in bytes (usually use sizeof(K)).
+ * @param   value_size  Size of each value in bytes (usually use sizeof(V)), may be 0.
+ *
+ * @return  An initialized ConcurrentMap_t, with shards = NULL if allocation failed.
+ *
+ * @note    The map MUST be freed later using free_concurrent_map().
+ */
+ConcurrentMap_t create_concurrent_map(size_t key_size, size_t value_size);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates an empty concurrent map with a custom shard count, key functions, and allocator.
+ *
+ * @param   key_size     Size of each key in bytes.
+ * @param   value_size   Size of each value in bytes, may be 0.
+ * @param   shard_count  Number of shards (rounded up to a power of two), or 0 for the default.
+ * @param   hash         Key hash function, or NULL for jester_hashmap_default_hash().
+ * @param   equals       Key equality function, or NULL for jester_hashmap_default_equals().
+ * @param   allocator    Allocator to use, or NULL for the global heap. It must be thread-safe.
+ *
+ * @return  An initialized ConcurrentMap_t, with shards = NULL on failure.
+ *
+ * @note    A custom @p equals only ever sees a validated private copy of a stored key,
+ *          which limits key_size to JESTER_CONCURRENT_MAP_MAX_KEY_SIZE in that case.
+ */
+ConcurrentMap_t create_concurrent_map_custom(size_t key_size, size_t value_size, size_t shard_count,
+                                             JesterHashFn hash, JesterEqualsFn equals,
+                                             const JesterAllocator_t* allocator);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Inserts a key/value pair, overwriting the value if the key is present.
+ *
+ * @param   map    Pointer to the target ConcurrentMap_t.
+ * @param   key    Pointer to the key to copy into the map.
+ * @param   value  Pointer to the value to copy, or NULL to zero-fill it.
+ *
+ * @return  Returns true on success, or false if a memory allocation fails.
+ */
+bool insert_concurrent_map(ConcurrentMap_t* map, const void* key, const void* value);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Inserts @p count key/value pairs, taking each shard's lock once.
+ *
+ * @details Pairs are grouped by shard first, then every shard that receives any is
+ *          grown once and filled under a single lock/seqlock window.
+ *
+ * @param   map     Pointer to the target ConcurrentMap_t.
+ * @param   keys    Array of @p count packed keys.
+ * @param   values  Array of @p count packed values, or NULL to zero-fill them.
+ * @param   count   Number of pairs.
+ *
+ * @return  Returns true on success, or false if a memory allocation fails (some
+ *          pairs may have been inserted).
+ */
+bool insert_concurrent_map_bulk(ConcurrentMap_t* map, const void* keys, const void* values, size_t count);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Looks up @p key without taking any lock.
+ *
+ * @param   map          Pointer to the target ConcurrentMap_t.
+ * @param   key          Pointer to the key.
+ * @param   destination  Optional buffer receiving a copy of the value. When false is
+ *                       returned it may hold torn bytes from a read that raced a
+ *                       writer, so it must not be used.
+ *
+ * @return  Returns true if the key was present.
+ */
+bool get_concurrent_map(const ConcurrentMap_t* map, const void* key, void* destination);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns true if @p key is present, without taking any lock.
+ */
+bool contains_concurrent_map(const ConcurrentMap_t* map, const void* key);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes @p key from the map.
+ *
+ * @param   map          Pointer to the target ConcurrentMap_t.
+ * @param   key          Pointer to the key to remove.
+ * @param   destination  Optional buffer receiving a copy of the removed value.
+ *
+ * @return  Returns true if the key was removed, or false if it was not present.
+ */
+bool remove_concurrent_map(ConcurrentMap_t* map, const void* key, void* destination);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the number of entries. Only a snapshot while writers are running.
+ */
+size_t get_concurrent_map_count(const ConcurrentMap_t* map);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Frees the tables retired by growth.
+ *
+ * @note    Only safe while no thread is inside a lookup (e.g. between work phases).
+ *
+ * @return  Returns true if memory was freed, or false if nothing was retired.
+ */
+bool reclaim_concurrent_map(ConcurrentMap_t* map);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Frees every shard and table.
+ *
+ * @note    Not thread-safe: no other thread may use the map during or after this call.
+ *
+ * @return  Returns true if memory was freed, or false if nothing was allocated.
+ */
+bool free_concurrent_map(ConcurrentMap_t* map);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,266 @@
+﻿/**
+ * @headerfile jester-hashmap.h
+ * @brief      Open-addressing hash map with SIMD-probed control bytes for the Jester stdlib.
+ *
+ * @details    Keys and values are stored inline in one flat slot array, with
+ *             no per-entry allocation and no pointer chasing. A parallel array
+ *             of one-byte control tags (7 bits of the hash, or EMPTY) is
+ *             scanned 16 slots at a time with SSE2: a lookup compares a whole
+ *             group of tags in a couple of instructions and only touches the
+ *             slots whose tag matches, so misses usually never read a key.
+ *
+ *             Probing is linear and deletion shifts later entries back into
+ *             the hole (backward-shift deletion), so there are no tombstones
+ *             and long-lived maps with heavy churn never degrade or need
+ *             rebuilding. The load factor is capped at 7/8.
+ *
+ *             Keys are compared as raw bytes by default. Keys that are not
+ *             plain values (e.g. pointers to strings) need a custom hash and
+ *             equality function, see create_hashmap_custom().
+ *
+ *             Example:
+ *             @code
+ *             HashMap_t index = create_hashmap(sizeof(uint64_t), sizeof(uint32_t));
+ *             insert_hashmap(&index, &id, &row);
+ *             uint32_t* found = get_hashmap_value(&index, &id);
+ *             free_hashmap(&index);
+ *             @endcode
+ *
+ * @copyright  GPL-3.0
+ * @author     Case Presley
+ * @date       10-17-2026
+ */
+
+#ifndef JESTER_STDLIB_JESTER_HASHMAP_H
+#define JESTER_STDLIB_JESTER_HASHMAP_H
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include <stdbool.h>                                       // |
+#include <stddef.h>                                        // |
+#include <stdint.h>                                        // |
+#include "jester/memory/jester-allocator.h"                // |
+//------------------------------------------------------------┙
+
+#define JESTER_HASHMAP_GROUP_WIDTH  16
+#define JESTER_HASHMAP_MIN_CAPACITY 16
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief  Hashes @p key_size bytes at @p key.
+ */
+typedef uint64_t (*JesterHashFn)(const void* key, size_t key_size);
+
+/**
+ * @brief  Returns true if the keys at @p a and @p b are equal.
+ */
+typedef bool (*JesterEqualsFn)(const void* a, const void* b, size_t key_size);
+
+/**
+ * @struct HashMap
+ * @brief  Flat open-addressing hash map with inline keys and values.
+ *
+ * @var    HashMap::control
+ *         One tag per slot (hash bits or EMPTY), followed by a mirror of the first
+ *         JESTER_HASHMAP_GROUP_WIDTH tags so a group load never wraps.
+ *
+ * @var    HashMap::slots
+ *         Slot array; each slot holds a key followed by its value.
+ *
+ * @var    HashMap::count
+ *         Number of entries in the map.
+ *
+ * @var    HashMap::capacity
+ *         Number of slots, always 0 or a power of two.
+ *
+ * @var    HashMap::key_size
+ *         Size of each key in bytes.
+ *
+ * @var    HashMap::value_size
+ *         Size of each value in bytes, may be 0.
+ *
+ * @var    HashMap::value_offset
+ *         Offset of the value within a slot.
+ *
+ * @var    HashMap::slot_size
+ *         Size of a slot in bytes.
+ *
+ * @var    HashMap::hash
+ *         Hash function applied to keys.
+ *
+ * @var    HashMap::equals
+ *         Key equality function.
+ *
+ * @var    HashMap::allocator
+ *         Allocator that owns the table. NULL selects the global heap.
+ */
+typedef struct HashMap
+{
+    uint8_t* control;
+    unsigned char* slots;
+    size_t count;
+    size_t capacity;
+    size_t key_size;
+    size_t value_size;
+    size_t value_offset;
+    size_t slot_size;
+    JesterHashFn hash;
+    JesterEqualsFn equals;
+    const JesterAllocator_t* allocator;
+} HashMap_t;
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Default key hash: jester_hash() over the key bytes with seed 0.
+ */
+uint64_t jester_hashmap_default_hash(const void* key, size_t key_size);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Default key equality: memcmp over the key bytes.
+ */
+bool jester_hashmap_default_equals(const void* a, const void* b, size_t key_size);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates an empty hash map comparing keys as raw bytes.
+ *
+ * @details No memory is allocated until the first insert or reserve.
+ *
+ * @param   key_size    Size of each key in bytes (usually use sizeof(K)).
+ * @param   value_size  Size of each value in bytes (usually use sizeof(V)), may be 0.
+ *
+ * @return  An initialized HashMap_t.
+ *
+ * @note    The map MUST be freed later using free_hashmap().
+ */
+HashMap_t create_hashmap(size_t key_size, size_t value_size);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates an empty hash map with custom key functions and allocator.
+ *
+ * @param   key_size    Size of each key in bytes.
+ * @param   value_size  Size of each value in bytes, may be 0.
+ * @param   hash        Key hash function, or NULL for jester_hashmap_default_hash().
+ * @param   equals      Key equality function, or NULL for jester_hashmap_default_equals().
+ * @param   allocator   Allocator to use, or NULL for the global heap.
+ *
+ * @return  An initialized HashMap_t.
+ */
+HashMap_t create_hashmap_custom(size_t key_size, size_t value_size, JesterHashFn hash, JesterEqualsFn equals,
+                                const JesterAllocator_t* allocator);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Ensures the map can hold @p count entries without rehashing.
+ *
+ * @return  Returns true on success, or false if a memory allocation fails.
+ */
+bool reserve_hashmap(HashMap_t* hashmap, size_t count);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Inserts a key/value pair, overwriting the value if the key is present.
+ *
+ * @param   hashmap  Pointer to the target HashMap_t.
+ * @param   key      Pointer to the key to copy into the map.
+ * @param   value    Pointer to the value to copy, or NULL to zero-fill it.
+ *
+ * @return  Returns true on success, or false if a memory allocation fails.
+ */
+bool insert_hashmap(HashMap_t* hashmap, const void* key, const void* value);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Finds the value for @p key, inserting a zero-filled one if it is missing.
+ *
+ * @param   hashmap   Pointer to the target HashMap_t.
+ * @param   key       Pointer to the key.
+ * @param   inserted  Optional, receives true if the key was newly inserted.
+ *
+ * @return  Pointer to the value slot, or NULL if a memory allocation fails.
+ *          The pointer is invalidated by the next insert or remove.
+ */
+void* get_or_insert_hashmap(HashMap_t* hashmap, const void* key, bool* inserted);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Looks up the value stored for @p key.
+ *
+ * @return  Pointer to the value, or NULL if the key is not present. The pointer
+ *          is invalidated by the next insert or remove.
+ */
+void* get_hashmap_value(const HashMap_t* hashmap, const void* key);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns true if @p key is present in the map.
+ */
+bool contains_hashmap(const HashMap_t* hashmap, const void* key);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes @p key from the map.
+ *
+ * @details Later entries in the probe run are shifted back into the hole, so no
+ *          tombstone is left behind.
+ *
+ * @param   hashmap      Pointer to the target HashMap_t.
+ * @param   key          Pointer to the key to remove.
+ * @param   destination  Optional buffer receiving a copy of the removed value.
+ *
+ * @return  Returns true if the key was removed, or false if it was not present.
+ */
+bool remove_hashmap(HashMap_t* hashmap, const void* key, void* destination);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Advances an iteration over every entry in the map.
+ *
+ * @details Start with *iterator = 0. Entries come in table order. The map must not
+ *          be modified during the iteration.
+ *
+ * @param   hashmap   Pointer to the target HashMap_t.
+ * @param   iterator  Iteration cursor, updated on each call.
+ * @param   key       Optional, receives a pointer to the entry's key.
+ * @param   value     Optional, receives a pointer to the entry's value.
+ *
+ * @return  Returns true if an entry was produced, or false once every entry has been visited.
+ */
+bool next_hashmap(const HashMap_t* hashmap, size_t* iterator, void** key, void** value);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes every entry, keeping the table for reuse.
+ *
+ * @return  Always returns true to indicate the operation completed successfully.
+ */
+bool clear_hashmap(HashMap_t* hashmap);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Frees the table and resets the map to an empty state.
+ *
+ * @details Key/value sizes, key functions, and the allocator are kept, so the map can be reused.
+ *
+ * @return  Returns true if memory was freed, or false if nothing was allocated.
+ */
+bool free_hashmap(HashMap_t* hashmap);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,133 @@
+﻿/**
+ * @headerfile jester-hashset.h
+ * @brief      Hash set of fixed-size keys for the Jester stdlib.
+ *
+ * @details    A HashMap_t with zero-sized values: the slots hold the keys and
+ *             nothing else, so a set costs exactly one key per slot plus one
+ *             control byte. Probing, deletion, and growth behave as described
+ *             in jester-hashmap.h.
+ *
+ *             For integer keys, JESTER_DEFINE_INT_SET() in jester-int-map.h avoids
+ *             the per-probe hash and equality calls entirely.
+ *
+ * @copyright  GPL-3.0
+ * @author     Case Presley
+ * @date       10-17-2026
+ */
+
+#ifndef JESTER_STDLIB_JESTER_HASHSET_H
+#define JESTER_STDLIB_JESTER_HASHSET_H
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include <stdbool.h>                                       // |
+#include <stddef.h>                                        // |
+#include "jester/datastructs/map/jester-hashmap.h"         // |
+//------------------------------------------------------------┙
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @struct HashSet
+ * @brief  Set of fixed-size keys.
+ *
+ * @var    HashSet::map
+ *         Underlying map with zero-sized values.
+ */
+typedef struct HashSet
+{
+    HashMap_t map;
+} HashSet_t;
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates an empty set comparing keys as raw bytes.
+ *
+ * @param   key_size  Size of each key in bytes (usually use sizeof(K)).
+ *
+ * @return  An initialized HashSet_t.
+ *
+ * @note    The set MUST be freed later using free_hashset().
+ */
+HashSet_t create_hashset(size_t key_size);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates an empty set with custom key functions and allocator.
+ *
+ * @see     create_hashmap_custom()
+ */
+HashSet_t create_hashset_custom(size_t key_size, JesterHashFn hash, JesterEqualsFn equals,
+                                const JesterAllocator_t* allocator);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Ensures the set can hold @p count keys without rehashing.
+ *
+ * @return  Returns true on success, or false if a memory allocation fails.
+ */
+bool reserve_hashset(HashSet_t* hashset, size_t count);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Adds a key to the set.
+ *
+ * @param   hashset  Pointer to the target HashSet_t.
+ * @param   key      Pointer to the key to copy into the set.
+ * @param   added    Optional, receives true if the key was not already present.
+ *
+ * @return  Returns true on success, or false if a memory allocation fails.
+ */
+bool insert_hashset(HashSet_t* hashset, const void* key, bool* added);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns true if @p key is in the set.
+ */
+bool contains_hashset(const HashSet_t* hashset, const void* key);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes @p key from the set.
+ *
+ * @return  Returns true if the key was removed, or false if it was not present.
+ */
+bool remove_hashset(HashSet_t* hashset, const void* key);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Advances an iteration over every key in the set.
+ *
+ * @details Start with *iterator = 0. The set must not be modified during the iteration.
+ *
+ * @return  Returns true if a key was produced, or false once every key has been visited.
+ */
+bool next_hashset(const HashSet_t* hashset, size_t* iterator, const void** key);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes every key, keeping the table for reuse.
+ *
+ * @return  Always returns true to indicate the operation completed successfully.
+ */
+bool clear_hashset(HashSet_t* hashset);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Frees the table and resets the set to an empty state.
+ *
+ * @return  Returns true if memory was freed, or false if nothing was allocated.
+ */
+bool free_hashset(HashSet_t* hashset);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+#endif
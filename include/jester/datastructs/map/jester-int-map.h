@@ -0,0 +1,353 @@
+﻿/**
+ * @headerfile jester-int-map.h
+ * @brief      Integer-key hash maps and sets generated by a macro template.
+ *
+ * @details    JESTER_DEFINE_INT_MAP(K, V, Name) generates a Name_t map from an
+ *             unsigned integer key (uint32_t or uint64_t) to a value of type V.
+ *             Unlike HashMap_t there are no function pointers and no byte-wise
+ *             key copies: keys and values sit side by side in one flat entry
+ *             array, the hash is a single multiply (Fibonacci hashing, keeping
+ *             the top bits of key * 2^64/phi), and a probe is an integer compare.
+ *             That makes it the map to reach for when lookups are by id.
+ *             JESTER_DEFINE_INT_SET(K, Name) is the same table with no value.
+ *
+ *             Key 0 marks an empty entry, so it needs no control bytes or
+ *             occupancy bitmap; a key that really is 0 is kept out of line in
+ *             the struct itself. Probing is linear, deletion shifts later
+ *             entries back into the hole (no tombstones), and the load factor
+ *             is capped at JESTER_INT_MAP_MAX_LOAD percent. 75 keeps the average
+ *             miss under about 8 probes; lower it to trade memory for speed.
+ *
+ *             Example:
+ *             @code
+ *             JESTER_DEFINE_INT_MAP(uint32_t, uint32_t, RowIndex)
+ *
+ *             RowIndex_t rows = create_RowIndex();
+ *             insert_RowIndex(&rows, entity_id, row);
+ *             uint32_t* found = get_RowIndex(&rows, entity_id);
+ *             free_RowIndex(&rows);
+ *             @endcode
+ *
+ * @copyright  GPL-3.0
+ * @author     Case Presley
+ * @date       10-17-2026
+ */
+
+#ifndef JESTER_STDLIB_JESTER_INT_MAP_H
+#define JESTER_STDLIB_JESTER_INT_MAP_H
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include <stdbool.h>                                       // |
+#include <stddef.h>                                        // |
+#include <stdint.h>                                        // |
+#include <stdlib.h>                                        // |
+#include <string.h>                                        // |
+//------------------------------------------------------------┙
+
+#define JESTER_INT_MAP_MIN_CAPACITY 16
+#define JESTER_INT_MAP_FIBONACCI    0x9E3779B97F4A7C15ull
+
+#ifndef JESTER_INT_MAP_MAX_LOAD
+#define JESTER_INT_MAP_MAX_LOAD 75
+#endif
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @def     JESTER_DEFINE_INT_MAP(K, V, Name)
+ * @brief   Defines the Name_t integer-key map type and its functions.
+ *
+ * @details Generated functions follow HashMap_t with typed keys and values:
+ *          - Name_t create_Name(void)                                  (never allocates)
+ *          - bool   reserve_Name(Name_t* m, size_t count)
+ *          - bool   insert_Name(Name_t* m, K key, V value)             (overwrites)
+ *          - V*     get_or_insert_Name(Name_t* m, K key, bool* inserted)
+ *          - V*     get_Name(Name_t* m, K key)                         (NULL if missing)
+ *          - bool   contains_Name(Name_t* m, K key)
+ *          - bool   remove_Name(Name_t* m, K key, V* destination)      (destination may be NULL)
+ *          - bool   next_Name(Name_t* m, size_t* iterator, K* key, V** value)
+ *          - bool   clear_Name(Name_t* m)
+ *          - bool   free_Name(Name_t* m)
+ *
+ *          Rehashing is kept out of line so the insert fast path stays small.
+ *
+ * @note    Use at file scope, once per key/value pair per translation unit. K must be
+ *          an unsigned integer type. Value pointers are invalidated by the next
+ *          insert or remove.
+ */
+#define JESTER_DEFINE_INT_MAP(K, V, Name)                                                                              \
+    typedef struct Name##Entry                                                                                         \
+    {                                                                                                                  \
+        K key;                                                                                                         \
+        V value;                                                                                                       \
+    } Name##Entry_t;                                                                                                   \
+                                                                                                                       \
+    typedef struct Name                                                                                                \
+    {                                                                                                                  \
+        Name##Entry_t* entries;                                                                                        \
+        size_t count;                                                                                                  \
+        size_t capacity;                                                                                               \
+        unsigned shift;                                                                                                \
+        bool has_zero;                                                                                                 \
+        V zero_value;                                                                                                  \
+    } Name##_t;                                                                                                        \
+                                                                                                                       \
+    static inline Name##_t create_##Name(void)                                                                         \
+    {                                                                                                                  \
+        Name##_t m = {};                                                                                               \
+        return m;                                                                                                      \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline size_t home_##Name(const Name##_t* m, const K key)                                                   \
+    {                                                                                                                  \
+        return (size_t)(((uint64_t)key * JESTER_INT_MAP_FIBONACCI) >> m->shift);                                       \
+    }                                                                                                                  \
+                                                                                                                       \
+    static __attribute__((noinline, unused)) bool rehash_##Name(Name##_t* m, const size_t new_capacity)                \
+    {                                                                                                                  \
+        Name##Entry_t* entries = (Name##Entry_t*)calloc(new_capacity, sizeof(Name##Entry_t));                          \
+        if (entries == NULL) return false;                                                                             \
+                                                                                                                       \
+        const unsigned shift = 64 - (unsigned)__builtin_ctzll((unsigned long long)new_capacity);                       \
+        const size_t mask    = new_capacity - 1;                                                                       \
+        for (size_t i = 0; i < m->capacity; i++)                                                                       \
+        {                                                                                                              \
+            if (m->entries[i].key == 0) continue;                                                                      \
+            size_t j = (size_t)(((uint64_t)m->entries[i].key * JESTER_INT_MAP_FIBONACCI) >> shift);                    \
+            while (entries[j].key != 0) j = (j + 1) & mask;                                                            \
+            entries[j] = m->entries[i];                                                                                \
+        }                                                                                                              \
+                                                                                                                       \
+        free(m->entries);                                                                                              \
+        m->entries  = entries;                                                                                         \
+        m->capacity = new_capacity;                                                                                    \
+        m->shift    = shift;                                                                                           \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool reserve_##Name(Name##_t* m, const size_t count)                                                 \
+    {                                                                                                                  \
+        size_t capacity = m->capacity ? m->capacity : JESTER_INT_MAP_MIN_CAPACITY;                                     \
+        while (count * 100 > capacity * JESTER_INT_MAP_MAX_LOAD)                                                       \
+        {                                                                                                              \
+            if (capacity > ((size_t)-1 / 2) / sizeof(Name##Entry_t)) return false;                                     \
+            capacity *= 2;                                                                                             \
+        }                                                                                                              \
+        return capacity == m->capacity || rehash_##Name(m, capacity);                                                  \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline size_t find_##Name(const Name##_t* m, const K key)                                                   \
+    {                                                                                                                  \
+        if (m->capacity == 0) return (size_t)-1;                                                                       \
+                                                                                                                       \
+        const size_t mask = m->capacity - 1;                                                                           \
+        for (size_t i = home_##Name(m, key);; i = (i + 1) & mask)                                                      \
+        {                                                                                                              \
+            if (m->entries[i].key == key) return i;                                                                    \
+            if (m->entries[i].key == 0) return (size_t)-1;                                                             \
+        }                                                                                                              \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline V* get_##Name(Name##_t* m, const K key)                                                              \
+    {                                                                                                                  \
+        if (key == 0) return m->has_zero ? &m->zero_value : NULL;                                                      \
+                                                                                                                       \
+        const size_t index = find_##Name(m, key);                                                                      \
+        return index != (size_t)-1 ? &m->entries[index].value : NULL;                                                  \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool contains_##Name(Name##_t* m, const K key)                                                       \
+    {                                                                                                                  \
+        return get_##Name(m, key) != NULL;                                                                             \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline V* get_or_insert_##Name(Name##_t* m, const K key, bool* inserted)                                    \
+    {                                                                                                                  \
+        if (inserted) *inserted = false;                                                                               \
+        if (key == 0)                                                                                                  \
+        {                                                                                                              \
+            if (!m->has_zero)                                                                                          \
+            {                                                                                                          \
+                memset(&m->zero_value, 0, sizeof(V));                                                                  \
+                m->has_zero = true;                                                                                    \
+                m->count++;                                                                                            \
+                if (inserted) *inserted = true;                                                                        \
+            }                                                                                                          \
+            return &m->zero_value;                                                                                     \
+        }                                                                                                              \
+                                                                                                                       \
+        const size_t stored = m->count - m->has_zero + 1;                                                              \
+        if (__builtin_expect(stored * 100 > m->capacity * JESTER_INT_MAP_MAX_LOAD, 0))                                 \
+        {                                                                                                              \
+            if (!reserve_##Name(m, stored)) return NULL;                                                               \
+        }                                                                                                              \
+                                                                                                                       \
+        const size_t mask = m->capacity - 1;                                                                           \
+        size_t i          = home_##Name(m, key);                                                                       \
+        while (m->entries[i].key != 0)                                                                                 \
+        {                                                                                                              \
+            if (m->entries[i].key == key) return &m->entries[i].value;                                                 \
+            i = (i + 1) & mask;                                                                                        \
+        }                                                                                                              \
+                                                                                                                       \
+        m->entries[i].key = key;                                                                                       \
+        memset(&m->entries[i].value, 0, sizeof(V));                                                                    \
+        m->count++;                                                                                                    \
+        if (inserted) *inserted = true;                                                                                \
+        return &m->entries[i].value;                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool insert_##Name(Name##_t* m, const K key, const V value)                                          \
+    {                                                                                                                  \
+        V* slot = get_or_insert_##Name(m, key, NULL);                                                                  \
+        if (slot == NULL) return false;                                                                                \
+        *slot = value;                                                                                                 \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool remove_##Name(Name##_t* m, const K key, V* destination)                                         \
+    {                                                                                                                  \
+        if (key == 0)                                                                                                  \
+        {                                                                                                              \
+            if (!m->has_zero) return false;                                                                            \
+            if (destination) *destination = m->zero_value;                                                             \
+            m->has_zero = false;                                                                                       \
+            m->count--;                                                                                                \
+            return true;                                                                                               \
+        }                                                                                                              \
+                                                                                                                       \
+        size_t hole = find_##Name(m, key);                                                                             \
+        if (hole == (size_t)-1) return false;                                                                          \
+        if (destination) *destination = m->entries[hole].value;                                                        \
+                                                                                                                       \
+        /* --- backward shift: pull later run members into the hole unless that passes their home --- */               \
+        const size_t mask = m->capacity - 1;                                                                           \
+        for (size_t next = (hole + 1) & mask; m->entries[next].key != 0; next = (next + 1) & mask)                     \
+        {                                                                                                              \
+            const size_t home = home_##Name(m, m->entries[next].key);                                                  \
+            if (((next - home) & mask) < ((next - hole) & mask)) continue;                                             \
+            m->entries[hole] = m->entries[next];                                                                       \
+            hole             = next;                                                                                   \
+        }                                                                                                              \
+                                                                                                                       \
+        m->entries[hole].key = 0;                                                                                      \
+        m->count--;                                                                                                    \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool next_##Name(Name##_t* m, size_t* iterator, K* key, V** value)                                   \
+    {                                                                                                                  \
+        for (; *iterator < m->capacity; (*iterator)++)                                                                 \
+        {                                                                                                              \
+            if (m->entries[*iterator].key == 0) continue;                                                              \
+            if (key) *key = m->entries[*iterator].key;                                                                 \
+            if (value) *value = &m->entries[*iterator].value;                                                          \
+            (*iterator)++;                                                                                             \
+            return true;                                                                                               \
+        }                                                                                                              \
+                                                                                                                       \
+        if (*iterator == m->capacity && m->has_zero)                                                                   \
+        {                                                                                                              \
+            if (key) *key = 0;                                                                                         \
+            if (value) *value = &m->zero_value;                                                                        \
+            (*iterator)++;                                                                                             \
+            return true;                                                                                               \
+        }                                                                                                              \
+        return false;                                                                                                  \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool clear_##Name(Name##_t* m)                                                                       \
+    {                                                                                                                  \
+        if (m->entries) memset(m->entries, 0, m->capacity * sizeof(Name##Entry_t));                                    \
+        m->has_zero = false;                                                                                           \
+        m->count    = 0;                                                                                               \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool free_##Name(Name##_t* m)                                                                        \
+    {                                                                                                                  \
+        if (m->entries == NULL && !m->has_zero) return false;                                                          \
+        free(m->entries);                                                                                              \
+        *m = create_##Name();                                                                                          \
+        return true;                                                                                                   \
+    }
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @def     JESTER_DEFINE_INT_SET(K, Name)
+ * @brief   Defines the Name_t integer set type and its functions.
+ *
+ * @details Instantiates JESTER_DEFINE_INT_MAP with an empty value type, so an
+ *          entry is just the key and every probe is the same multiply and integer
+ *          compare. Generated functions follow HashSet_t with typed keys:
+ *          - Name_t create_Name(void)                                  (never allocates)
+ *          - bool   reserve_Name(Name_t* s, size_t count)
+ *          - bool   insert_Name(Name_t* s, K key, bool* added)         (added may be NULL)
+ *          - bool   contains_Name(Name_t* s, K key)
+ *          - bool   remove_Name(Name_t* s, K key)
+ *          - bool   next_Name(Name_t* s, size_t* iterator, K* key)
+ *          - bool   clear_Name(Name_t* s)
+ *          - bool   free_Name(Name_t* s)
+ *
+ *          The number of keys is s->map.count.
+ *
+ * @note    Use at file scope, once per key type per translation unit. K must be an
+ *          unsigned integer type. Relies on GNU C zero-sized empty structs.
+ */
+#define JESTER_DEFINE_INT_SET(K, Name)                                                                                 \
+    typedef struct Name##Nothing                                                                                       \
+    {                                                                                                                  \
+    } Name##Nothing_t;                                                                                                 \
+                                                                                                                       \
+    JESTER_DEFINE_INT_MAP(K, Name##Nothing_t, Name##Map)                                                               \
+                                                                                                                       \
+    typedef struct Name                                                                                                \
+    {                                                                                                                  \
+        Name##Map_t map;                                                                                               \
+    } Name##_t;                                                                                                        \
+                                                                                                                       \
+    static inline Name##_t create_##Name(void)                                                                         \
+    {                                                                                                                  \
+        Name##_t s = {create_##Name##Map()};                                                                           \
+        return s;                                                                                                      \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool reserve_##Name(Name##_t* s, const size_t count)                                                 \
+    {                                                                                                                  \
+        return reserve_##Name##Map(&s->map, count);                                                                    \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool insert_##Name(Name##_t* s, const K key, bool* added)                                            \
+    {                                                                                                                  \
+        return get_or_insert_##Name##Map(&s->map, key, added) != NULL;                                                 \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool contains_##Name(Name##_t* s, const K key)                                                       \
+    {                                                                                                                  \
+        return contains_##Name##Map(&s->map, key);                                                                     \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool remove_##Name(Name##_t* s, const K key)                                                         \
+    {                                                                                                                  \
+        return remove_##Name##Map(&s->map, key, NULL);                                                                 \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool next_##Name(Name##_t* s, size_t* iterator, K* key)                                              \
+    {                                                                                                                  \
+        return next_##Name##Map(&s->map, iterator, key, NULL);                                                         \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool clear_##Name(Name##_t* s)                                                                       \
+    {                                                                                                                  \
+        return clear_##Name##Map(&s->map);                                                                             \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool free_##Name(Name##_t* s)                                                                        \
+    {                                                                                                                  \
+        return free_##Name##Map(&s->map);                                                                              \
+    }
+
+// ---------------------------------------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,10 @@
+﻿#ifndef JESTER_STDLIB_JESTER_MAP_H
+#define JESTER_STDLIB_JESTER_MAP_H
+
+#include "jester/datastructs/map/jester-slot-map.h"
+#include "jester/datastructs/map/jester-hashmap.h"
+#include "jester/datastructs/map/jester-hashset.h"
+#include "jester/datastructs/map/jester-int-map.h"
+#include "jester/datastructs/map/jester-concurrent-map.h"
+
+#endif
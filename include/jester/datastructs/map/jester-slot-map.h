@@ -0,0 +1,189 @@
+﻿/**
+ * @headerfile jester-slot-map.h
+ * @brief      Generational-handle slot map for the Jester stdlib.
+ *
+ * @details    Stores values densely in a DynamicArray_t and hands out 64-bit
+ *             handles that name a slot plus the generation it was filled in.
+ *             Removing a value moves the last value into its place, so the
+ *             values stay packed for iteration with no tombstones to skip or
+ *             compact. Freed slots are reused through a free list, and their
+ *             generation is bumped so stale handles are detected rather than
+ *             resolving to whatever now lives in the slot. Insert, remove, and
+ *             lookup are all O(1).
+ *
+ *             Example:
+ *             @code
+ *             SlotMap_t entities = create_slot_map(sizeof(Entity_t));
+ *             SlotMapHandle_t h  = insert_slot_map(&entities, &player);
+ *             Entity_t* e        = get_slot_map_element(&entities, h);
+ *
+ *             Entity_t* all = entities.values.data;
+ *             for (size_t i = 0; i < entities.values.count; i++) update(&all[i]);
+ *
+ *             remove_slot_map(&entities, h, NULL);   // h is now stale
+ *             free_slot_map(&entities);
+ *             @endcode
+ *
+ * @copyright  GPL-3.0
+ * @author     Case Presley
+ * @date       10-17-2026
+ */
+
+#ifndef JESTER_STDLIB_JESTER_SLOT_MAP_H
+#define JESTER_STDLIB_JESTER_SLOT_MAP_H
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include <stdbool.h>                                       // |
+#include <stddef.h>                                        // |
+#include <stdint.h>                                        // |
+#include "jester/datastructs/array/jester-dynamic-array.h" // |
+//------------------------------------------------------------┙
+
+// --- never returned by a successful insert ---
+#define JESTER_SLOT_MAP_INVALID_HANDLE ((SlotMapHandle_t)0)
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief  Handle to a slot map value: generation in the high 32 bits, slot index in the low 32 bits.
+ */
+typedef uint64_t SlotMapHandle_t;
+
+/**
+ * @struct SlotMap
+ * @brief  Dense value storage addressed through generational handles.
+ *
+ * @var    SlotMap::values
+ *         Densely packed values, in no particular order. Safe to iterate directly.
+ *
+ * @var    SlotMap::dense_slots
+ *         For each value, the index (uint32_t) of the slot that refers to it.
+ *
+ * @var    SlotMap::slots
+ *         Slot table. A slot's generation is odd while it holds a value; its
+ *         second field is then the value's dense index, or the next free slot
+ *         while it is free.
+ *
+ * @var    SlotMap::free_head
+ *         First slot on the free list, or UINT32_MAX when every slot is in use.
+ */
+typedef struct SlotMap
+{
+    DynamicArray_t values;
+    DynamicArray_t dense_slots;
+    DynamicArray_t slots;
+    uint32_t free_head;
+} SlotMap_t;
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates an empty slot map for values of a fixed size.
+ *
+ * @details No memory is allocated until the first insert.
+ *
+ * @param   value_size  Size of each value in bytes (usually use sizeof(T)).
+ *
+ * @return  An initialized SlotMap_t.
+ *
+ * @note    The map MUST be freed later using free_slot_map().
+ */
+SlotMap_t create_slot_map(size_t value_size);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates an empty slot map whose storage comes from @p allocator.
+ *
+ * @param   value_size  Size of each value in bytes (usually use sizeof(T)).
+ * @param   allocator   Allocator to use, or NULL for the global heap.
+ *
+ * @return  An initialized SlotMap_t.
+ */
+SlotMap_t create_slot_map_with_allocator(size_t value_size, const JesterAllocator_t* allocator);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Copies a value into the slot map.
+ *
+ * @details Reuses a free slot when there is one, otherwise appends a new slot.
+ *
+ * @param   slot_map  Pointer to the target SlotMap_t.
+ * @param   value     Pointer to the value to copy into the map.
+ *
+ * @return  Handle to the stored value, or JESTER_SLOT_MAP_INVALID_HANDLE if a
+ *          memory allocation failed or the map already holds 2^32 - 1 slots.
+ */
+SlotMapHandle_t insert_slot_map(SlotMap_t* slot_map, const void* value);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Looks up the value a handle refers to.
+ *
+ * @details The returned pointer refers to dense storage and is invalidated by
+ *          any insert or remove; hold on to the handle instead.
+ *
+ * @return  Pointer to the value, or NULL if the handle is stale or invalid.
+ */
+void* get_slot_map_element(const SlotMap_t* slot_map, SlotMapHandle_t handle);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns true if @p handle still refers to a value in the map.
+ */
+bool contains_slot_map(const SlotMap_t* slot_map, SlotMapHandle_t handle);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes the value a handle refers to.
+ *
+ * @details The last value is moved into the hole to keep storage dense, and the
+ *          slot's generation is bumped so every copy of @p handle becomes stale.
+ *
+ * @param   slot_map     Pointer to the target SlotMap_t.
+ * @param   handle       Handle of the value to remove.
+ * @param   destination  Optional buffer receiving a copy of the removed value.
+ *
+ * @return  Returns true if a value was removed, or false if the handle was stale or invalid.
+ */
+bool remove_slot_map(SlotMap_t* slot_map, SlotMapHandle_t handle, void* destination);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the handle of the value at position @p dense_index in @p values.
+ *
+ * @details Lets code that iterates the dense values remove or hand out the
+ *          value it is looking at.
+ *
+ * @return  The value's handle, or JESTER_SLOT_MAP_INVALID_HANDLE if the index is out of range.
+ */
+SlotMapHandle_t get_slot_map_handle(const SlotMap_t* slot_map, size_t dense_index);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes every value, invalidating all outstanding handles.
+ *
+ * @details Keeps the allocated storage and puts every slot on the free list.
+ *
+ * @return  Always returns true to indicate the operation completed successfully.
+ */
+bool clear_slot_map(SlotMap_t* slot_map);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Frees all memory owned by the slot map and resets it to an empty state.
+ *
+ * @return  Returns true if memory was freed, or false if the map owned none.
+ */
+bool free_slot_map(SlotMap_t* slot_map);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+#endif
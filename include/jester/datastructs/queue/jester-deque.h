@@ -0,0 +1,279 @@
+﻿/**
+ * @headerfile jester-deque.h
+ * @brief      Ring buffer / double-ended queue for the Jester stdlib.
+ *
+ * @details    A circular buffer with power-of-two capacity, so positions wrap
+ *             with a mask instead of a division. Elements can be pushed and
+ *             popped at both ends in O(1), which makes it a FIFO queue, a
+ *             stack, or a sliding window without the O(n) memmove that
+ *             front-removal from a DynamicArray_t costs. Bulk push/pop at
+ *             either end copy at most two runs, and the span accessors expose
+ *             the contiguous readable run at the front and writable run at the
+ *             back so I/O can read or write the buffer in place.
+ *
+ *             Example (zero-copy reads from a file descriptor):
+ *             @code
+ *             Deque_t bytes = create_deque(1, 4096);
+ *             size_t room;
+ *             void* span = get_deque_back_span(&bytes, &room);
+ *             ssize_t n  = read(fd, span, room);
+ *             if (n > 0) commit_deque_back(&bytes, (size_t)n);
+ *             @endcode
+ *
+ * @copyright  GPL-3.0
+ * @author     Case Presley
+ * @date       10-17-2026
+ */
+
+#ifndef JESTER_STDLIB_JESTER_DEQUE_H
+#define JESTER_STDLIB_JESTER_DEQUE_H
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include <stdbool.h>                                       // |
+#include <stddef.h>                                        // |
+#include "jester/memory/jester-allocator.h"                // |
+//------------------------------------------------------------┙
+
+#define JESTER_DEQUE_MIN_CAPACITY 8
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @struct Deque
+ * @brief  Circular double-ended queue of fixed-size elements.
+ *
+ * @var    Deque::data
+ *         Pointer to the ring storage.
+ *
+ * @var    Deque::head
+ *         Slot of the front element.
+ *
+ * @var    Deque::count
+ *         Current number of elements in use.
+ *
+ * @var    Deque::capacity
+ *         Number of slots in the ring, always 0 or a power of two.
+ *
+ * @var    Deque::element_size
+ *         Size of each element within the deque in bytes.
+ *
+ * @var    Deque::allocator
+ *         Allocator that owns @p data. NULL selects the global heap.
+ */
+typedef struct Deque
+{
+    void* data;
+    size_t head;
+    size_t count;
+    size_t capacity;
+    size_t element_size;
+    const JesterAllocator_t* allocator;
+} Deque_t;
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates a deque for elements of a fixed size.
+ *
+ * @param   element_size  Size of each element in bytes (usually use sizeof(T)).
+ * @param   capacity      Initial number of elements, rounded up to a power of two.
+ *                        0 allocates nothing until the first push.
+ *
+ * @return  A Deque_t instance. If allocation fails, the returned struct will have
+ *          data = NULL and capacity = 0.
+ *
+ * @note    The deque MUST be freed later using free_deque().
+ */
+Deque_t create_deque(size_t element_size, size_t capacity);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates a deque whose storage comes from @p allocator.
+ */
+Deque_t create_deque_with_allocator(size_t element_size, size_t capacity, const JesterAllocator_t* allocator);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Ensures the deque can hold at least @p new_capacity elements.
+ *
+ * @details Growing allocates a new ring (rounded up to a power of two) and copies
+ *          the elements across in order, so afterwards they start at slot 0.
+ *
+ * @return  Returns true on success, or false if a memory allocation fails.
+ */
+bool reserve_deque(Deque_t* deque, size_t new_capacity);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Appends a copy of an element at the back.
+ *
+ * @return  Returns true on success, or false if a memory allocation fails.
+ */
+bool push_back_deque(Deque_t* deque, const void* data);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Prepends a copy of an element at the front.
+ *
+ * @return  Returns true on success, or false if a memory allocation fails.
+ */
+bool push_front_deque(Deque_t* deque, const void* data);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes the front element.
+ *
+ * @param   deque        Pointer to the target Deque_t.
+ * @param   destination  Optional buffer receiving a copy of the removed element.
+ *
+ * @return  Returns true if an element was removed, or false if the deque was empty.
+ */
+bool pop_front_deque(Deque_t* deque, void* destination);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes the back element.
+ *
+ * @param   deque        Pointer to the target Deque_t.
+ * @param   destination  Optional buffer receiving a copy of the removed element.
+ *
+ * @return  Returns true if an element was removed, or false if the deque was empty.
+ */
+bool pop_back_deque(Deque_t* deque, void* destination);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Retrieves a pointer to the element @p index positions from the front.
+ *
+ * @return  Pointer to the element, or NULL if the index is invalid.
+ */
+void* get_deque_element(const Deque_t* deque, size_t index);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Appends @p count contiguous elements at the back.
+ *
+ * @details Grows at most once and copies in at most two runs.
+ *
+ * @return  Returns true on success, or false if a memory allocation fails.
+ */
+bool push_back_deque_bulk(Deque_t* deque, const void* source, size_t count);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Prepends @p count contiguous elements at the front, keeping their order.
+ *
+ * @details The first source element becomes the new front. Grows at most once and
+ *          copies in at most two runs.
+ *
+ * @return  Returns true on success, or false if a memory allocation fails.
+ */
+bool push_front_deque_bulk(Deque_t* deque, const void* source, size_t count);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes up to @p count elements from the front.
+ *
+ * @param   deque        Pointer to the target Deque_t.
+ * @param   destination  Optional buffer receiving the removed elements in order.
+ * @param   count        Maximum number of elements to remove.
+ *
+ * @return  The number of elements removed.
+ */
+size_t pop_front_deque_bulk(Deque_t* deque, void* destination, size_t count);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes up to @p count elements from the back.
+ *
+ * @param   deque        Pointer to the target Deque_t.
+ * @param   destination  Optional buffer receiving the removed elements in front-to-back order.
+ * @param   count        Maximum number of elements to remove.
+ *
+ * @return  The number of elements removed.
+ */
+size_t pop_back_deque_bulk(Deque_t* deque, void* destination, size_t count);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the contiguous run of elements starting at the front.
+ *
+ * @details The run ends at the back or at the end of the ring storage, whichever
+ *          comes first. Call consume_deque_front() once the elements are used.
+ *
+ * @param   deque  Pointer to the target Deque_t.
+ * @param   count  Receives the number of elements in the run.
+ *
+ * @return  Pointer to the front element, or NULL if the deque is empty.
+ */
+void* get_deque_front_span(const Deque_t* deque, size_t* count);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Drops @p count elements from the front without copying them.
+ *
+ * @return  Returns true on success, or false if the deque holds fewer than @p count elements.
+ */
+bool consume_deque_front(Deque_t* deque, size_t count);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the contiguous run of free slots just past the back.
+ *
+ * @details The run ends at the front or at the end of the ring storage, whichever
+ *          comes first. Fill it, then call commit_deque_back(). Call reserve_deque()
+ *          first to guarantee room.
+ *
+ * @param   deque  Pointer to the target Deque_t.
+ * @param   count  Receives the number of free slots in the run.
+ *
+ * @return  Pointer to the first free slot, or NULL if the deque is full.
+ */
+void* get_deque_back_span(const Deque_t* deque, size_t* count);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Appends @p count elements already written into the back span.
+ *
+ * @return  Returns true on success, or false if @p count exceeds the back span.
+ */
+bool commit_deque_back(Deque_t* deque, size_t count);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes all elements, keeping the ring storage.
+ *
+ * @return  Always returns true to indicate the operation completed successfully.
+ */
+bool clear_deque(Deque_t* deque);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Frees the ring storage and resets the deque to an empty state.
+ *
+ * @details The element size and allocator are kept, so the deque can be reused.
+ *
+ * @return  Returns true if memory was freed, or false if nothing was allocated.
+ */
+bool free_deque(Deque_t* deque);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+#endif
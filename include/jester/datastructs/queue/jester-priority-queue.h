@@ -0,0 +1,396 @@
+﻿/**
+ * @headerfile jester-priority-queue.h
+ * @brief      Binary / d-ary heap priority queues for the Jester stdlib.
+ *
+ * @details    PriorityQueue_t keeps fixed-size elements in a DynamicArray_t in
+ *             implicit heap order under a user comparator: push and pop are
+ *             O(log n), peek is O(1), and heapify_priority_queue() builds the
+ *             heap from a whole array in O(n) instead of n pushes. That makes
+ *             it a drop-in for "sort everything, take the front" patterns such
+ *             as timer scheduling and top-k selection.
+ *
+ *             - Arity 4 (or 8) halves (or thirds) the tree height, and the
+ *               children of a node are adjacent, so a sift-down reads one or
+ *               two cache lines per level instead of chasing twice as many
+ *               levels. It pays off for large heaps and cheap comparators.
+ *             - With handles enabled, every pushed element gets a stable
+ *               PriorityQueueHandle_t that follows it through the heap, so
+ *               its priority can be changed (decrease-key) or the element
+ *               removed (timer cancellation) in O(log n).
+ *
+ *             JESTER_DEFINE_PRIORITY_QUEUE() generates a typed variant whose
+ *             comparator and arity are compile-time constants, for hot paths
+ *             that do not need handles.
+ *
+ *             Example (earliest deadline first):
+ *             @code
+ *             static bool earlier(const void* a, const void* b)
+ *             {
+ *                 return ((const Timer_t*)a)->deadline < ((const Timer_t*)b)->deadline;
+ *             }
+ *
+ *             PriorityQueue_t timers = create_priority_queue_custom(sizeof(Timer_t), earlier, 4, true, NULL);
+ *             PriorityQueueHandle_t handle;
+ *             push_priority_queue(&timers, &timer, &handle);
+ *             timer.deadline = now;
+ *             update_priority_queue(&timers, handle, &timer);  // fire sooner
+ *             pop_priority_queue(&timers, &timer);
+ *             free_priority_queue(&timers);
+ *             @endcode
+ *
+ * @copyright  GPL-3.0
+ * @author     Case Presley
+ * @date       10-17-2026
+ */
+
+#ifndef JESTER_STDLIB_JESTER_PRIORITY_QUEUE_H
+#define JESTER_STDLIB_JESTER_PRIORITY_QUEUE_H
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include <stdbool.h>                                       // |
+#include <stddef.h>                                        // |
+#include <stdint.h>                                        // |
+#include <stdlib.h>                                        // |
+#include <string.h>                                        // |
+#include "jester/datastructs/array/jester-dynamic-array.h" // |
+#include "jester/datastructs/array/jester-typed-array.h"   // |
+#include "jester/memory/jester-allocator.h"                // |
+//------------------------------------------------------------┙
+
+#define JESTER_PRIORITY_QUEUE_INVALID_HANDLE ((PriorityQueueHandle_t)SIZE_MAX)
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief  Returns true if the element at @p a must leave the queue before the one at @p b.
+ *
+ * @note   Must be a strict weak ordering; "less" gives a min-queue, "greater" a max-queue.
+ */
+typedef bool (*JesterLessFn)(const void* a, const void* b);
+
+/**
+ * @brief  Stable reference to an element of a PriorityQueue_t created with handles.
+ *
+ * @note   A handle is valid from the push that returned it until its element is popped,
+ *         removed, or the queue is cleared; afterwards it may be reused for a new element.
+ */
+typedef size_t PriorityQueueHandle_t;
+
+/**
+ * @struct PriorityQueue
+ * @brief  Heap-ordered priority queue of fixed-size elements.
+ *
+ * @var    PriorityQueue::heap
+ *         Elements in implicit heap order; the front element is at index 0.
+ *
+ * @var    PriorityQueue::handles
+ *         Handle of the element at each heap index (only with handles).
+ *
+ * @var    PriorityQueue::positions
+ *         Heap index of the element behind each handle, or SIZE_MAX if the handle is free.
+ *
+ * @var    PriorityQueue::free_handles
+ *         Released handles available for reuse.
+ *
+ * @var    PriorityQueue::less
+ *         Comparator ordering the elements.
+ *
+ * @var    PriorityQueue::arity_shift
+ *         log2 of the number of children per node (1, 2, or 3).
+ *
+ * @var    PriorityQueue::track_handles
+ *         Whether handles are maintained.
+ */
+typedef struct PriorityQueue
+{
+    DynamicArray_t heap;
+    DynamicArray_t handles;
+    DynamicArray_t positions;
+    DynamicArray_t free_handles;
+    JesterLessFn less;
+    unsigned arity_shift;
+    bool track_handles;
+} PriorityQueue_t;
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates a binary-heap priority queue without handles on the global heap.
+ *
+ * @param   element_size  Size of each element in bytes (usually use sizeof(T)).
+ * @param   less          Comparator; the element it orders first is popped first.
+ *
+ * @return  An empty PriorityQueue_t. Storage is allocated on the first push.
+ *
+ * @note    The queue MUST be freed later using free_priority_queue().
+ */
+PriorityQueue_t create_priority_queue(size_t element_size, JesterLessFn less);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates a priority queue with a chosen arity, optional handles, and allocator.
+ *
+ * @param   element_size   Size of each element in bytes.
+ * @param   less           Comparator; the element it orders first is popped first.
+ * @param   arity          Children per node: 2, 4, or 8. Other values select 2.
+ * @param   track_handles  Maintain handles for update_priority_queue() and remove_priority_queue().
+ *                         Costs one extra index write per element moved.
+ * @param   allocator      Allocator to use, or NULL for the global heap.
+ */
+PriorityQueue_t create_priority_queue_custom(size_t element_size, JesterLessFn less, size_t arity, bool track_handles,
+                                             const JesterAllocator_t* allocator);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Ensures the queue can hold @p capacity elements without reallocating.
+ *
+ * @return  Returns true on success, or false if a memory allocation fails.
+ */
+bool reserve_priority_queue(PriorityQueue_t* queue, size_t capacity);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Inserts a copy of an element.
+ *
+ * @param   queue    Pointer to the target PriorityQueue_t.
+ * @param   element  Element to copy in.
+ * @param   handle   Optional; receives the element's handle, or JESTER_PRIORITY_QUEUE_INVALID_HANDLE
+ *                   if the queue does not track handles.
+ *
+ * @return  Returns true on success, or false if a memory allocation fails (the queue is left unchanged).
+ */
+bool push_priority_queue(PriorityQueue_t* queue, const void* element, PriorityQueueHandle_t* handle);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the front element without removing it.
+ *
+ * @return  Pointer to the front element, valid until the queue is next modified, or NULL if it is empty.
+ */
+const void* peek_priority_queue(const PriorityQueue_t* queue);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes the front element.
+ *
+ * @param   queue        Pointer to the target PriorityQueue_t.
+ * @param   destination  Optional buffer receiving a copy of the removed element.
+ *
+ * @return  Returns true if an element was removed, or false if the queue was empty.
+ */
+bool pop_priority_queue(PriorityQueue_t* queue, void* destination);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Adds @p count elements at once and restores heap order in O(n).
+ *
+ * @details Uses bottom-up heap construction over the whole queue, which is
+ *          cheaper than @p count pushes whenever the batch is not tiny
+ *          compared to the elements already queued.
+ *
+ * @param   queue    Pointer to the target PriorityQueue_t.
+ * @param   source   Contiguous array of @p count elements.
+ * @param   count    Number of elements to add.
+ * @param   handles  Optional array of @p count entries receiving the handles of the
+ *                   added elements in source order (only with handles).
+ *
+ * @return  Returns true on success, or false if a memory allocation fails (the queue is left unchanged).
+ */
+bool heapify_priority_queue(PriorityQueue_t* queue, const void* source, size_t count, PriorityQueueHandle_t* handles);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Replaces the element behind @p handle and moves it to its new place.
+ *
+ * @details Decrease-key and increase-key alike: the element sifts toward the
+ *          front or the back as its new value requires.
+ *
+ * @return  Returns true on success, or false if the handle is not valid.
+ */
+bool update_priority_queue(PriorityQueue_t* queue, PriorityQueueHandle_t handle, const void* element);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes the element behind @p handle, wherever it is in the queue.
+ *
+ * @param   queue        Pointer to the target PriorityQueue_t.
+ * @param   handle       Handle of the element to remove.
+ * @param   destination  Optional buffer receiving a copy of the removed element.
+ *
+ * @return  Returns true if an element was removed, or false if the handle is not valid.
+ */
+bool remove_priority_queue(PriorityQueue_t* queue, PriorityQueueHandle_t handle, void* destination);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the element behind @p handle.
+ *
+ * @return  Pointer to the element, valid until the queue is next modified, or NULL if the handle is not valid.
+ *
+ * @note    Do not modify the element in place; use update_priority_queue().
+ */
+const void* get_priority_queue_element(const PriorityQueue_t* queue, PriorityQueueHandle_t handle);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the number of queued elements.
+ */
+size_t get_priority_queue_count(const PriorityQueue_t* queue);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Removes every element, keeping the storage for reuse. All handles become invalid.
+ *
+ * @return  Always returns true to indicate the operation completed successfully.
+ */
+bool clear_priority_queue(PriorityQueue_t* queue);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Frees the queue's storage and resets it to an empty state.
+ *
+ * @return  Returns true if memory was freed, or false if nothing was allocated.
+ */
+bool free_priority_queue(PriorityQueue_t* queue);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @def     JESTER_DEFINE_PRIORITY_QUEUE(T, LESS, ARITY, Name)
+ * @brief   Defines the Name_t priority queue type and its functions for element type T.
+ *
+ * @details LESS(a, b) is a function or macro taking two T values and returning true
+ *          if a must leave the queue before b; ARITY is the constant number of children
+ *          per node (2, 4, ...). Both are inlined into the sift loops. Generated functions:
+ *          - Name_t   create_Name(size_t capacity)
+ *          - bool     reserve_Name(Name_t* q, size_t new_capacity)
+ *          - bool     push_Name(Name_t* q, T value)
+ *          - const T* peek_Name(const Name_t* q)                  (NULL if empty)
+ *          - bool     pop_Name(Name_t* q, T* destination)         (destination may be NULL)
+ *          - bool     heapify_Name(Name_t* q, const T* source, size_t count)
+ *          - bool     clear_Name(Name_t* q)
+ *          - bool     free_Name(Name_t* q)
+ *
+ *          Storage is a JESTER_DEFINE_ARRAY array, Name##Heap_t, kept in the heap field
+ *          in implicit heap order. The typed queue has no handles; use PriorityQueue_t
+ *          when elements must be updated or removed after they are pushed.
+ *
+ * @note    Use at file scope, once per element type per translation unit.
+ */
+#define JESTER_DEFINE_PRIORITY_QUEUE(T, LESS, ARITY, Name)                                                             \
+    JESTER_DEFINE_ARRAY(T, Name##Heap)                                                                                 \
+                                                                                                                       \
+    typedef struct Name                                                                                                \
+    {                                                                                                                  \
+        Name##Heap_t heap;                                                                                             \
+    } Name##_t;                                                                                                        \
+                                                                                                                       \
+    static inline bool reserve_##Name(Name##_t* q, const size_t new_capacity)                                          \
+    {                                                                                                                  \
+        if (new_capacity > SIZE_MAX / sizeof(T)) return false;                                                         \
+        return reserve_##Name##Heap(&q->heap, new_capacity);                                                           \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline Name##_t create_##Name(const size_t capacity)                                                        \
+    {                                                                                                                  \
+        Name##_t q = {create_##Name##Heap(capacity)};                                                                  \
+        return q;                                                                                                      \
+    }                                                                                                                  \
+                                                                                                                       \
+    /* --- move the hole down past every child that beats value, then fill it --- */                                   \
+    static inline void sift_down_##Name(Name##_t* q, size_t hole, const T value)                                       \
+    {                                                                                                                  \
+        T* data            = q->heap.data;                                                                             \
+        const size_t count = q->heap.count;                                                                            \
+        for (;;)                                                                                                       \
+        {                                                                                                              \
+            const size_t first = (hole * (ARITY)) + 1;                                                                 \
+            if (first >= count) break;                                                                                 \
+            const size_t last = count - first < (ARITY) ? count : first + (ARITY);                                     \
+            size_t best       = first;                                                                                 \
+            for (size_t child = first + 1; child < last; child++)                                                      \
+            {                                                                                                          \
+                if (LESS(data[child], data[best])) best = child;                                                       \
+            }                                                                                                          \
+            if (!LESS(data[best], value)) break;                                                                       \
+            data[hole] = data[best];                                                                                   \
+            hole       = best;                                                                                         \
+        }                                                                                                              \
+        data[hole] = value;                                                                                            \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool push_##Name(Name##_t* q, const T value)                                                         \
+    {                                                                                                                  \
+        if (__builtin_expect(q->heap.count == q->heap.capacity, 0) && !grow_##Name##Heap(&q->heap)) return false;      \
+        T* data     = q->heap.data;                                                                                    \
+        size_t hole = q->heap.count++;                                                                                 \
+        while (hole > 0)                                                                                               \
+        {                                                                                                              \
+            const size_t parent = (hole - 1) / (ARITY);                                                                \
+            if (!LESS(value, data[parent])) break;                                                                     \
+            data[hole] = data[parent];                                                                                 \
+            hole       = parent;                                                                                       \
+        }                                                                                                              \
+        data[hole] = value;                                                                                            \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline const T* peek_##Name(const Name##_t* q)                                                              \
+    {                                                                                                                  \
+        return q->heap.count ? &q->heap.data[0] : NULL;                                                                \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool pop_##Name(Name##_t* q, T* destination)                                                         \
+    {                                                                                                                  \
+        if (q->heap.count == 0) return false;                                                                          \
+        if (destination) *destination = q->heap.data[0];                                                               \
+        q->heap.count--;                                                                                               \
+        if (q->heap.count != 0) sift_down_##Name(q, 0, q->heap.data[q->heap.count]);                                   \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool heapify_##Name(Name##_t* q, const T* source, const size_t count)                                \
+    {                                                                                                                  \
+        if (count > SIZE_MAX - q->heap.count) return false;                                                            \
+        const size_t total = q->heap.count + count;                                                                    \
+        if (total > q->heap.capacity)                                                                                  \
+        {                                                                                                              \
+            /* --- keep pushes after a heapify amortized: at least double, as grow does --- */                         \
+            const size_t doubled = q->heap.capacity * 2;                                                               \
+            if (!reserve_##Name(q, doubled > total ? doubled : total)) return false;                                   \
+        }                                                                                                              \
+        if (count != 0) memcpy(q->heap.data + q->heap.count, source, sizeof(T) * count);                               \
+        q->heap.count = total;                                                                                         \
+        /* --- Floyd: sift down every internal node, last parent first --- */                                          \
+        for (size_t i = total > 1 ? ((total - 2) / (ARITY)) + 1 : 0; i-- > 0;)                                         \
+        {                                                                                                              \
+            sift_down_##Name(q, i, q->heap.data[i]);                                                                   \
+        }                                                                                                              \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool clear_##Name(Name##_t* q)                                                                       \
+    {                                                                                                                  \
+        return clear_##Name##Heap(&q->heap);                                                                           \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool free_##Name(Name##_t* q)                                                                        \
+    {                                                                                                                  \
+        return free_##Name##Heap(&q->heap);                                                                            \
+    }
+
+// ---------------------------------------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,7 @@
+﻿#ifndef JESTER_STDLIB_JESTER_QUEUE_H
+#define JESTER_STDLIB_JESTER_QUEUE_H
+
+#include "jester/datastructs/queue/jester-deque.h"
+#include "jester/datastructs/queue/jester-priority-queue.h"
+
+#endif
@@ -0,0 +1,185 @@
+﻿/**
+ * @headerfile jester-hash.h
+ * @brief      Fast non-cryptographic 64-bit hashing for the Jester stdlib.
+ *
+ * @details    An XXH3-style hash built around 64x64->128-bit multiplies.
+ *             Inputs up to 16 bytes take one or two multiplies, inputs up to
+ *             256 bytes fold 16-byte pairs, and longer inputs are consumed in
+ *             64-byte stripes by eight parallel accumulators that are
+ *             vectorized with AVX2 or SSE2 (chosen at run time on x86) and run
+ *             tens of GB/s on long keys. Every length class is keyed by a fixed
+ *             192-byte secret and the seed.
+ *
+ *             The streaming API produces exactly the same value as the
+ *             one-shot function for the same bytes, however they are split.
+ *
+ *             The hashes are NOT cryptographic and must not be exposed to
+ *             attacker-chosen keys where collisions matter; use a random seed
+ *             if inputs are untrusted. Results are stable across runs and
+ *             platforms for the same seed (little-endian byte order).
+ *
+ * @copyright  GPL-3.0
+ * @author     Case Presley
+ * @date       10-17-2026
+ */
+
+#ifndef JESTER_STDLIB_JESTER_HASH_H
+#define JESTER_STDLIB_JESTER_HASH_H
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include <stdbool.h>                                       // |
+#include <stddef.h>                                        // |
+#include <stdint.h>                                        // |
+//------------------------------------------------------------┙
+
+#define JESTER_HASH_SECRET_SIZE 192
+#define JESTER_HASH_BUFFER_SIZE 256
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @enum   JesterHashKernel
+ * @brief  Stripe kernels of the long-input path.
+ *
+ * @var    JesterHashKernel::JESTER_HASH_KERNEL_AUTO
+ *         Widest kernel the running CPU supports (default).
+ *
+ * @var    JesterHashKernel::JESTER_HASH_KERNEL_SCALAR
+ *         Portable 64-bit code.
+ *
+ * @var    JesterHashKernel::JESTER_HASH_KERNEL_SSE2
+ *         Two accumulators per 128-bit vector (x86 only).
+ *
+ * @var    JesterHashKernel::JESTER_HASH_KERNEL_AVX2
+ *         Four accumulators per 256-bit vector (x86 only).
+ */
+typedef enum JesterHashKernel
+{
+    JESTER_HASH_KERNEL_AUTO = 0,
+    JESTER_HASH_KERNEL_SCALAR,
+    JESTER_HASH_KERNEL_SSE2,
+    JESTER_HASH_KERNEL_AVX2
+} JesterHashKernel_t;
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @struct JesterHashState
+ * @brief  Streaming hash state. Treat as opaque.
+ *
+ * @var    JesterHashState::accumulators
+ *         Stripe accumulators of the long-input path.
+ *
+ * @var    JesterHashState::secret
+ *         Secret keyed with the seed.
+ *
+ * @var    JesterHashState::buffer
+ *         Input not yet consumed, at least one byte is always held back.
+ *
+ * @var    JesterHashState::previous
+ *         Last 64 consumed bytes, needed when the final stripe reaches back before the buffer.
+ *
+ * @var    JesterHashState::total
+ *         Number of bytes fed so far.
+ *
+ * @var    JesterHashState::seed
+ *         Seed given to jester_hash_init().
+ *
+ * @var    JesterHashState::buffered
+ *         Number of bytes in the buffer.
+ *
+ * @var    JesterHashState::stripes
+ *         Stripes consumed in the current block.
+ */
+typedef struct JesterHashState
+{
+    _Alignas(32) uint64_t accumulators[8];
+    unsigned char secret[JESTER_HASH_SECRET_SIZE];
+    unsigned char buffer[JESTER_HASH_BUFFER_SIZE];
+    unsigned char previous[64];
+    uint64_t total;
+    uint64_t seed;
+    size_t buffered;
+    size_t stripes;
+} JesterHashState_t;
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Hashes @p size bytes at @p data.
+ *
+ * @param   data  Bytes to hash, may be NULL when @p size is 0.
+ * @param   size  Number of bytes.
+ * @param   seed  Seed; different seeds give independent hash functions.
+ *
+ * @return  The 64-bit hash.
+ */
+uint64_t jester_hash(const void* data, size_t size, uint64_t seed);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Mixes a 64-bit integer into a well-distributed 64-bit hash.
+ *
+ * @details A bijective finalizer (every input bit affects every output bit), so
+ *          distinct integers never collide. Cheaper than jester_hash() on the
+ *          integer's bytes.
+ */
+uint64_t jester_hash_u64(uint64_t value);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Combines two hashes into one, e.g. for composite keys.
+ *
+ * @details Order matters: combining (a, b) differs from (b, a).
+ *
+ * @return  A hash of the pair.
+ */
+uint64_t jester_hash_combine(uint64_t seed, uint64_t hash);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Starts a streaming hash.
+ *
+ * @param   state  State to initialize.
+ * @param   seed   Seed, as for jester_hash().
+ */
+void jester_hash_init(JesterHashState_t* state, uint64_t seed);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Feeds @p size more bytes into a streaming hash.
+ */
+void jester_hash_update(JesterHashState_t* state, const void* data, size_t size);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the hash of every byte fed so far.
+ *
+ * @details Does not modify the state, so more bytes may be fed afterwards.
+ *
+ * @return  The same value jester_hash() returns for the concatenated input.
+ */
+uint64_t jester_hash_final(const JesterHashState_t* state);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Pins the long-input path to one kernel, for tests and benchmarks.
+ *
+ * @details Every kernel produces the same hashes; this only changes speed.
+ *
+ * @return  Returns true on success, or false if the kernel is not available on
+ *          this CPU or build (the current choice is kept).
+ *
+ * @note    Not thread-safe: call it while no other thread is hashing.
+ */
+bool jester_hash_set_kernel(JesterHashKernel_t kernel);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+#endif
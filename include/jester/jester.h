@@ -1,3 +1,9 @@
 ﻿#pragma once
 #include "jester/log/jester-log.h"
+#include "jester/log/jester-trace.h"
 #include "jester/datastructs/jester-datastructs.h"
+#include "jester/memory/jester-memory.h"
+#include "jester/time/jester-time.h"
+#include "jester/hash/jester-hash.h"
+#include "jester/string/jester-string.h"
+#include "jester/string/jester-intern.h"
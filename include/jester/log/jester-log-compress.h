@@ -0,0 +1,59 @@
+﻿#ifndef JESTER_LOG_JESTER_LOG_COMPRESS_H
+#define JESTER_LOG_JESTER_LOG_COMPRESS_H
+
+#include "jester/datastructs/array/jester-dynamic-array.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define LOG_COMPRESS_BLOCK_SIZE (64 * 1024)
+
+// File layout:
+//   block   := "JLZB" flags:u32 raw_size:u32 packed_size:u32 payload[packed_size]
+//   index   := "JLZI" count:u32 entry[count] footer
+//   entry   := file_offset:u64 raw_offset:u64 raw_size:u32 packed_size:u32
+//   footer  := index_offset:u64 "JLZE" reserved:u32
+// Every block decompresses on its own. The index written on close covers every block
+// in the file (including earlier sessions), so a reader can seek straight to any raw
+// offset. A file without a valid footer (e.g. after a crash) is indexed by scanning
+// block headers instead. All integers are little-endian.
+
+typedef struct LogBlockIndex
+{
+    uint64_t file_offset;
+    uint64_t raw_offset;
+    uint32_t raw_size;
+    uint32_t packed_size;
+} LogBlockIndex_t;
+
+typedef struct LogCompressedFile
+{
+    FILE* file;
+    unsigned char* raw;
+    size_t raw_len;
+    unsigned char* packed;
+    uint64_t raw_total;
+    DynamicArray_t index;
+} LogCompressedFile_t;
+
+// --- block codec (LZ77 with 64 KiB window, byte-aligned sequences) ---
+size_t log_compress_bound(size_t size);
+size_t log_compress_block(const void* src, size_t size, void* dst, size_t capacity);
+size_t log_decompress_block(const void* src, size_t size, void* dst, size_t capacity);
+
+// --- writer, used by the file sink when LogConfig_t::compress_enabled is set ---
+// The file must be opened for appending and reading ("a+b").
+LogCompressedFile_t* log_compressed_open(FILE* file);
+bool log_compressed_write(LogCompressedFile_t* writer, const void* data, size_t size);
+bool log_compressed_flush(LogCompressedFile_t* writer);
+bool log_compressed_close(LogCompressedFile_t* writer);
+
+// --- reader ---
+bool log_compressed_read_index(FILE* file, DynamicArray_t* index);
+const LogBlockIndex_t* log_compressed_find_block(const DynamicArray_t* index, uint64_t raw_offset);
+bool log_compressed_read_block(FILE* file, const LogBlockIndex_t* entry, void* out);
+bool log_decompress_file(FILE* in, FILE* out);
+
+#endif // JESTER_LOG_JESTER_LOG_COMPRESS_H
@@ -2,9 +2,16 @@
 #define JESTER_LOG_JESTER_LOG_H
 
 #include <stdarg.h>
+#include <stdatomic.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 
+#define LOG_QUEUE_SIZE        128
+#define LOG_MAX_MODULE_RULES  32
+#define LOG_MODULE_PREFIX_MAX 64
+#define LOG_BACKEND_BATCH     32
+
 typedef enum LogLevel
 {
     DEBUG,
@@ -18,6 +25,7 @@ typedef void (*LogSinkFn)(LogLevel_t level, const char* file, int line, const ch
 
 void log_set_sink(LogSinkFn sink, void* user_data);
 void log_msg(LogLevel_t level, const char* file, int line, const char* format, ...);
+void log_write(LogLevel_t level, const char* file, int line, const char* format, ...);
 void set_min_log_level(LogLevel_t level);
 void toggle_color(bool enabled);
 void toggle_file(bool enabled);
@@ -36,7 +44,7 @@ typedef struct LogRecord
 
 typedef struct LogQueue
 {
-    LogRecord_t records[SIZE];
+    LogRecord_t records[LOG_QUEUE_SIZE];
     int head;
     int tail;
     int count;
@@ -52,18 +60,85 @@ typedef struct LogConfig
     LogSinkFn sink;
     void* sink_user_data;
     FILE* file;
-    LogQueue_t console_queue;
-    LogQueue_t file_queue;
+    LogQueue_t* console_queue;
+    LogQueue_t* file_queue;
+    bool compress_enabled;                       // write the file as independently decompressible blocks (.jlz)
+    struct LogCompressedFile* compressed_file;
 } LogConfig_t;
 
 bool log_init(const LogConfig_t* cfg);
-void enqueue(const LogRecord_t* record, const LogQueue_t* queue);
+bool enqueue(const LogRecord_t* record, LogQueue_t* queue);
+
+// --- logger instances ---
+// Every JesterLogger_t owns its queues, sinks and a backend thread that writes them out, so
+// a high-volume logger cannot starve or block another. log_init() / log_msg() / LOG_* and the
+// other global functions operate on the default instance, returned by log_default_logger().
+// Per-module level rules only apply to the default instance; others filter on their own
+// minimum level. logger_create() expands strftime() patterns in cfg->file_name.
+typedef struct JesterLogger JesterLogger_t;
+
+JesterLogger_t* logger_create(const LogConfig_t* cfg);
+void logger_destroy(JesterLogger_t* logger);
+JesterLogger_t* log_default_logger(void);
+void logger_log(JesterLogger_t* logger, LogLevel_t level, const char* file, int line, const char* format, ...);
+void logger_vlog(JesterLogger_t* logger, LogLevel_t level, const char* file, int line, const char* format,
+                 va_list args);
+void logger_flush(JesterLogger_t* logger);
+void logger_set_min_level(JesterLogger_t* logger, LogLevel_t level);
+void logger_set_sink(JesterLogger_t* logger, LogSinkFn sink, void* user_data);
+
+// Wakes the default instance's backend thread to run trace_drain_stream(). Tracing
+// calls it when a trace buffer fills or a tracing thread exits.
+void log_request_trace_drain(void);
+
+// --- per-module level filtering ---
+// Rules map a module / file prefix to a minimum level, e.g. "net=DEBUG,db=WARN".
+// A rule matches when its prefix starts any path component of __FILE__; the longest
+// matching prefix wins and files without a match fall back to set_min_log_level().
+// A bare level ("INFO" or "*=INFO") sets that fallback.
+bool log_set_module_levels(const char* spec);
+void log_clear_module_levels(void);
+LogLevel_t log_level_for_file(const char* file);
+
+// Every LOG_* call site owns one LogSite_t. Its state packs the generation it was
+// resolved in (upper 24 bits) with the effective level (low 8 bits); any configuration
+// change bumps log_level_generation so stale sites re-resolve on their next call.
+typedef struct LogSite
+{
+    _Atomic uint32_t state;
+} LogSite_t;
+
+extern _Atomic uint32_t log_level_generation;
+
+uint32_t log_resolve_site(LogSite_t* site, const char* file);
+
+static inline bool log_site_enabled(LogSite_t* site, const char* file, const LogLevel_t level)
+{
+    uint32_t state = atomic_load_explicit(&site->state, memory_order_relaxed);
+    if ((state >> 8) != atomic_load_explicit(&log_level_generation, memory_order_relaxed))
+        state = log_resolve_site(site, file);
+    return (uint32_t)level >= (state & 0xFFu);
+}
+
+#define LOG_AT(level, format, ...)                                                                                     \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        static LogSite_t log_site_;                                                                                    \
+        if (log_site_enabled(&log_site_, __FILE__, level))                                                             \
+            log_write(level, __FILE__, __LINE__, format, ##__VA_ARGS__);                                               \
+    } while (0)
+
+#define LOG_DEBUG(format, ...)   LOG_AT(DEBUG,   format, ##__VA_ARGS__)
+#define LOG_INFO(format, ...)    LOG_AT(INFO,    format, ##__VA_ARGS__)
+#define LOG_WARNING(format, ...) LOG_AT(WARNING, format, ##__VA_ARGS__)
+#define LOG_ERROR(format, ...)   LOG_AT(ERROR,   format, ##__VA_ARGS__)
+#define LOG_FATAL(format, ...)   LOG_AT(FATAL,   format, ##__VA_ARGS__)
 
-#define LOG_DEBUG(format, ...)   log_msg(DEBUG,   __FILE__, __LINE__, format, ##__VA_ARGS__)
-#define LOG_INFO(format, ...)    log_msg(INFO,    __FILE__, __LINE__, format, ##__VA_ARGS__)
-#define LOG_WARNING(format, ...) log_msg(WARNING, __FILE__, __LINE__, format, ##__VA_ARGS__)
-#define LOG_ERROR(format, ...)   log_msg(ERROR,   __FILE__, __LINE__, format, ##__VA_ARGS__)
-#define LOG_FATAL(format, ...)   log_msg(FATAL,   __FILE__, __LINE__, format, ##__VA_ARGS__)
+#define LOGGER_DEBUG(logger, format, ...)   logger_log(logger, DEBUG,   __FILE__, __LINE__, format, ##__VA_ARGS__)
+#define LOGGER_INFO(logger, format, ...)    logger_log(logger, INFO,    __FILE__, __LINE__, format, ##__VA_ARGS__)
+#define LOGGER_WARNING(logger, format, ...) logger_log(logger, WARNING, __FILE__, __LINE__, format, ##__VA_ARGS__)
+#define LOGGER_ERROR(logger, format, ...)   logger_log(logger, ERROR,   __FILE__, __LINE__, format, ##__VA_ARGS__)
+#define LOGGER_FATAL(logger, format, ...)   logger_log(logger, FATAL,   __FILE__, __LINE__, format, ##__VA_ARGS__)
 
 #define LOG_INIT_DEFAULT() log_init(NULL)
 #define LOG_FLUSH()        log_flush()
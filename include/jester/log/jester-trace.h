@@ -0,0 +1,75 @@
+﻿#ifndef JESTER_LOG_JESTER_TRACE_H
+#define JESTER_LOG_JESTER_TRACE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define TRACE_BUFFER_EVENTS 4096
+
+// Span names are stored by pointer, so they must outlive the trace (string literals).
+typedef struct TraceEvent
+{
+    const char* name;
+    uint64_t timestamp_ns;
+    uint32_t thread_id;
+    char phase;
+} TraceEvent_t;
+
+void trace_enable(bool enabled);
+bool trace_is_enabled(void);
+void trace_begin(const char* name);
+void trace_end(const char* name);
+
+// Writes every event recorded since the previous export in Chrome / Perfetto
+// trace-event JSON format. Buffers that are full, or whose thread has exited,
+// are released afterwards.
+bool trace_write_json(FILE* out);
+bool trace_export_json(const char* file_name);
+
+// Streams the trace to file_name from the default logger's backend thread: it
+// drains the buffers whenever one fills or a tracing thread exits, and on every
+// log_flush() and log_shutdown(). trace_shutdown() writes the rest and closes it.
+bool trace_open_stream(const char* file_name);
+void trace_drain_stream(void);
+
+// Number of per-thread buffers currently held.
+size_t trace_buffer_count(void);
+
+// Closes the stream and releases every per-thread buffer. No thread may be
+// tracing concurrently.
+void trace_shutdown(void);
+
+typedef struct TraceScope
+{
+    const char* name;
+} TraceScope_t;
+
+static inline TraceScope_t trace_scope_begin(const char* name)
+{
+    trace_begin(name);
+    return (TraceScope_t){name};
+}
+
+static inline void trace_scope_end(const TraceScope_t* scope)
+{
+    trace_end(scope->name);
+}
+
+#define JESTER_TRACE_CONCAT_(a, b) a##b
+#define JESTER_TRACE_CONCAT(a, b)  JESTER_TRACE_CONCAT_(a, b)
+
+#ifdef JESTER_TRACE_DISABLED
+#define JESTER_TRACE_BEGIN(name) ((void)0)
+#define JESTER_TRACE_END(name)   ((void)0)
+#define JESTER_TRACE_SCOPE(name) ((void)0)
+#else
+#define JESTER_TRACE_BEGIN(name) trace_begin(name)
+#define JESTER_TRACE_END(name)   trace_end(name)
+#define JESTER_TRACE_SCOPE(name)                                                                                       \
+    TraceScope_t JESTER_TRACE_CONCAT(trace_scope_, __LINE__) __attribute__((cleanup(trace_scope_end), unused)) =      \
+        trace_scope_begin(name)
+#endif
+
+#endif // JESTER_LOG_JESTER_TRACE_H
@@ -0,0 +1,96 @@
+﻿/**
+ * @headerfile jester-allocator.h
+ * @brief      Pluggable allocator interface for the Jester stdlib.
+ *
+ * @details    Containers take a JesterAllocator_t describing where their memory
+ *             comes from (global heap, arena, pool, huge pages, ...). Every
+ *             callback receives the allocator's user context and the size of
+ *             the block involved, so allocators that do not track sizes
+ *             themselves (such as bump allocators) can still reallocate and free.
+ *
+ * @copyright  GPL-3.0
+ * @author     Case Presley
+ * @date       10-16-2026
+ */
+
+#ifndef JESTER_STDLIB_JESTER_ALLOCATOR_H
+#define JESTER_STDLIB_JESTER_ALLOCATOR_H
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include <stddef.h>                                        // |
+//------------------------------------------------------------┙
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @struct JesterAllocator
+ * @brief  Allocation vtable plus the user context passed to every callback.
+ *
+ * @var    JesterAllocator::allocate
+ *         Returns a block of at least @p size bytes aligned for any fundamental
+ *         type, or NULL on failure.
+ *
+ * @var    JesterAllocator::reallocate
+ *         Resizes the block at @p ptr (currently @p old_size bytes) to @p new_size
+ *         bytes, preserving its contents up to the smaller of the two sizes. When
+ *         @p ptr is NULL it must behave like allocate. Returns NULL on failure, in
+ *         which case the original block is left untouched.
+ *
+ * @var    JesterAllocator::deallocate
+ *         Releases the block at @p ptr of @p size bytes. NULL must be accepted.
+ *
+ * @var    JesterAllocator::context
+ *         User pointer handed to every callback (e.g. the arena or pool instance).
+ */
+typedef struct JesterAllocator
+{
+    void* (*allocate)(void* context, size_t size);
+    void* (*reallocate)(void* context, void* ptr, size_t old_size, size_t new_size);
+    void  (*deallocate)(void* context, void* ptr, size_t size);
+    void* context;
+} JesterAllocator_t;
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the allocator backed by malloc/realloc/free.
+ *
+ * @details Containers use it whenever they are given a NULL allocator.
+ *
+ * @return  Pointer to a static JesterAllocator_t, valid for the program's lifetime.
+ */
+const JesterAllocator_t* jester_heap_allocator(void);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Allocates through @p allocator, or the heap allocator if it is NULL.
+ */
+static inline void* jester_allocate(const JesterAllocator_t* allocator, const size_t size)
+{
+    if (allocator == NULL) allocator = jester_heap_allocator();
+    return allocator->allocate(allocator->context, size);
+}
+
+/**
+ * @brief   Reallocates through @p allocator, or the heap allocator if it is NULL.
+ */
+static inline void* jester_reallocate(const JesterAllocator_t* allocator, void* ptr, const size_t old_size,
+                                      const size_t new_size)
+{
+    if (allocator == NULL) allocator = jester_heap_allocator();
+    return allocator->reallocate(allocator->context, ptr, old_size, new_size);
+}
+
+/**
+ * @brief   Frees through @p allocator, or the heap allocator if it is NULL.
+ */
+static inline void jester_deallocate(const JesterAllocator_t* allocator, void* ptr, const size_t size)
+{
+    if (allocator == NULL) allocator = jester_heap_allocator();
+    allocator->deallocate(allocator->context, ptr, size);
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,190 @@
+﻿/**
+ * @headerfile jester-arena.h
+ * @brief      Arena (bump) allocator for the Jester stdlib.
+ *
+ * @details    Hands out memory by bumping a pointer through large chunks and
+ *             releases everything at once, which suits groups of short-lived
+ *             objects that all die together (e.g. per-request state). Supports
+ *             aligned allocations, marks and rewinding, O(1) reset that keeps
+ *             the chunks for reuse, and arenas backed by a fixed caller-owned
+ *             buffer such as a stack array. An arena can also be handed to any
+ *             container through the JesterAllocator_t interface.
+ *
+ * @copyright  GPL-3.0
+ * @author     Case Presley
+ * @date       10-16-2026
+ */
+
+#ifndef JESTER_STDLIB_JESTER_ARENA_H
+#define JESTER_STDLIB_JESTER_ARENA_H
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include <stdbool.h>                                       // |
+#include <stddef.h>                                        // |
+#include "jester/memory/jester-allocator.h"                // |
+//------------------------------------------------------------┙
+
+#define JESTER_ARENA_DEFAULT_CHUNK_SIZE (64 * 1024)
+#define JESTER_ARENA_DEFAULT_ALIGNMENT  16
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @struct Arena
+ * @brief  Chunked bump allocator.
+ *
+ * @var    Arena::first
+ *         First chunk in the chain; reset_arena() rewinds to it.
+ *
+ * @var    Arena::current
+ *         Chunk currently being bumped. Chunks after it are kept for reuse.
+ *
+ * @var    Arena::chunk_size
+ *         Usable size of regularly allocated chunks in bytes.
+ *
+ * @var    Arena::backing
+ *         Allocator the chunks come from. NULL selects the global heap.
+ *
+ * @var    Arena::fixed
+ *         True when the arena lives in a caller-owned buffer and cannot grow.
+ *
+ * @var    Arena::allocator
+ *         JesterAllocator_t view of this arena, see get_arena_allocator().
+ */
+typedef struct Arena
+{
+    struct ArenaChunk* first;
+    struct ArenaChunk* current;
+    size_t chunk_size;
+    const JesterAllocator_t* backing;
+    bool fixed;
+    JesterAllocator_t allocator;
+} Arena_t;
+
+/**
+ * @struct ArenaMark
+ * @brief  Saved arena position, see mark_arena() and rewind_arena().
+ */
+typedef struct ArenaMark
+{
+    struct ArenaChunk* chunk;
+    size_t used;
+} ArenaMark_t;
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates an arena that allocates chunks from the global heap.
+ *
+ * @details No memory is allocated until the first allocation.
+ *
+ * @param   chunk_size  Usable bytes per chunk, or 0 for JESTER_ARENA_DEFAULT_CHUNK_SIZE.
+ *                      Allocations larger than this get a dedicated chunk.
+ *
+ * @return  An initialized Arena_t.
+ *
+ * @note    The arena MUST be freed later using free_arena(), and must not be moved
+ *          (copied by value) once get_arena_allocator() has been handed out.
+ */
+Arena_t create_arena(size_t chunk_size);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates an arena whose chunks come from @p backing.
+ *
+ * @param   chunk_size  Usable bytes per chunk, or 0 for the default.
+ * @param   backing     Allocator used for chunks, or NULL for the global heap.
+ *
+ * @return  An initialized Arena_t.
+ */
+Arena_t create_arena_with_allocator(size_t chunk_size, const JesterAllocator_t* backing);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates a fixed-size arena inside a caller-owned buffer.
+ *
+ * @details The buffer (e.g. a stack array) holds the chunk bookkeeping and all
+ *          allocations. The arena never grows: once the buffer is exhausted,
+ *          allocations return NULL. free_arena() does not release the buffer.
+ *
+ * @param   buffer  Memory to carve allocations from.
+ * @param   size    Size of @p buffer in bytes.
+ *
+ * @return  An initialized Arena_t, or one that fails every allocation if the
+ *          buffer is too small to hold the chunk header.
+ */
+Arena_t create_arena_from_buffer(void* buffer, size_t size);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Allocates @p size bytes aligned to JESTER_ARENA_DEFAULT_ALIGNMENT.
+ *
+ * @return  Pointer to uninitialized memory, or NULL if a chunk allocation fails
+ *          or a fixed arena is exhausted.
+ */
+void* allocate_arena(Arena_t* arena, size_t size);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Allocates @p size bytes aligned to @p alignment.
+ *
+ * @param   arena      Pointer to the target Arena_t.
+ * @param   size       Number of bytes to allocate.
+ * @param   alignment  Required alignment, a power of two.
+ *
+ * @return  Pointer to uninitialized memory, or NULL on failure.
+ */
+void* allocate_arena_aligned(Arena_t* arena, size_t size, size_t alignment);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Records the current arena position.
+ */
+ArenaMark_t mark_arena(const Arena_t* arena);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Releases everything allocated after @p mark was taken.
+ *
+ * @details Chunks allocated after the mark are kept and reused by later
+ *          allocations rather than being freed.
+ */
+void rewind_arena(Arena_t* arena, ArenaMark_t mark);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Releases every allocation in O(1), keeping the chunks for reuse.
+ */
+void reset_arena(Arena_t* arena);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Frees all chunks owned by the arena and resets it to an empty state.
+ *
+ * @return  Returns true if any chunk was freed, or false if the arena owned none.
+ */
+bool free_arena(Arena_t* arena);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns a JesterAllocator_t that allocates from this arena.
+ *
+ * @details Deallocation is a no-op except for the most recent allocation, which
+ *          is popped off the arena. Reallocating the most recent allocation grows
+ *          it in place when the chunk has room, so a DynamicArray_t that is the
+ *          only user of an arena rarely copies.
+ */
+const JesterAllocator_t* get_arena_allocator(Arena_t* arena);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,8 @@
+﻿#ifndef JESTER_STDLIB_JESTER_MEMORY_H
+#define JESTER_STDLIB_JESTER_MEMORY_H
+
+#include "jester/memory/jester-allocator.h"
+#include "jester/memory/jester-arena.h"
+#include "jester/memory/jester-pool.h"
+
+#endif
@@ -0,0 +1,169 @@
+﻿/**
+ * @headerfile jester-pool.h
+ * @brief      Fixed-size object pool allocator for the Jester stdlib.
+ *
+ * @details    Serves blocks of a single size from slabs carved into an
+ *             intrusive free list. Each thread works out of its own magazine
+ *             (a small stack of free blocks on a private cache line), so most
+ *             allocate/free pairs never touch the shared free list or its lock.
+ *             Magazines are refilled from, and spill half their contents back
+ *             to, the shared list in batches.
+ *
+ * @copyright  GPL-3.0
+ * @author     Case Presley
+ * @date       10-16-2026
+ */
+
+#ifndef JESTER_STDLIB_JESTER_POOL_H
+#define JESTER_STDLIB_JESTER_POOL_H
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include <pthread.h>                                       // |
+#include <stdatomic.h>                                     // |
+#include <stdbool.h>                                       // |
+#include <stddef.h>                                        // |
+#include "jester/memory/jester-allocator.h"                // |
+//------------------------------------------------------------┙
+
+#define JESTER_POOL_MAGAZINE_SIZE      64
+#define JESTER_POOL_MAX_THREAD_CACHES  64
+#define JESTER_POOL_DEFAULT_SLAB_COUNT 256
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @struct PoolCache
+ * @brief  Per-thread magazine of free blocks, padded to its own cache line.
+ *
+ * @details A thread claims a free slot on first use and gives it back when it
+ *          exits, flushing its blocks to the shared list. Only when more than
+ *          JESTER_POOL_MAX_THREAD_CACHES threads are alive at once does a thread
+ *          borrow an owned slot; @p busy is then taken as a trylock, and whoever
+ *          misses it goes straight to the shared list instead of spinning.
+ */
+typedef struct PoolCache
+{
+    _Alignas(64) atomic_flag busy;
+    atomic_bool owned;
+    unsigned count;
+    struct Pool* pool;
+    void* blocks[JESTER_POOL_MAGAZINE_SIZE];
+} PoolCache_t;
+
+/**
+ * @struct Pool
+ * @brief  Fixed-size block allocator.
+ *
+ * @var    Pool::block_size
+ *         Size of every block in bytes (the requested size rounded up for alignment).
+ *
+ * @var    Pool::blocks_per_slab
+ *         Number of blocks carved out of each slab when the pool grows.
+ *
+ * @var    Pool::backing
+ *         Allocator slabs come from. NULL selects the global heap.
+ *
+ * @var    Pool::lock
+ *         Guards @p free_list and @p slabs.
+ *
+ * @var    Pool::free_list
+ *         Shared intrusive list of free blocks; each free block stores the next pointer.
+ *
+ * @var    Pool::slabs
+ *         Chain of slabs owned by the pool.
+ *
+ * @var    Pool::caches
+ *         JESTER_POOL_MAX_THREAD_CACHES per-thread magazines.
+ *
+ * @var    Pool::caches_block
+ *         Raw allocation holding @p caches before cache-line alignment.
+ *
+ * @var    Pool::thread_key
+ *         Maps each thread to its magazine; its destructor releases the slot on thread exit.
+ *
+ * @var    Pool::allocator
+ *         JesterAllocator_t view of this pool, see get_pool_allocator().
+ */
+typedef struct Pool
+{
+    size_t block_size;
+    size_t blocks_per_slab;
+    const JesterAllocator_t* backing;
+    pthread_mutex_t lock;
+    void* free_list;
+    struct PoolSlab* slabs;
+    PoolCache_t* caches;
+    void* caches_block;
+    pthread_key_t thread_key;
+    JesterAllocator_t allocator;
+} Pool_t;
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates a pool of @p block_size byte blocks backed by the global heap.
+ *
+ * @param   block_size       Size of each block in bytes.
+ * @param   blocks_per_slab  Blocks per slab, or 0 for JESTER_POOL_DEFAULT_SLAB_COUNT.
+ *
+ * @return  An initialized Pool_t. If allocation of the thread caches fails, the
+ *          returned pool has caches = NULL and every allocation fails.
+ *
+ * @note    The pool MUST be freed later using free_pool(), and must not be moved
+ *          (copied by value) once it has been used.
+ */
+Pool_t create_pool(size_t block_size, size_t blocks_per_slab);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates a pool whose slabs and caches come from @p backing.
+ */
+Pool_t create_pool_with_allocator(size_t block_size, size_t blocks_per_slab, const JesterAllocator_t* backing);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Takes one block from the pool.
+ *
+ * @details Served from the calling thread's magazine; refilled from the shared
+ *          free list (growing the pool by a slab if needed) only when it is empty.
+ *
+ * @return  Pointer to an uninitialized block, or NULL if growing the pool failed.
+ */
+void* allocate_pool_block(Pool_t* pool);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns a block to the pool.
+ *
+ * @details Pushed onto the calling thread's magazine; half the magazine is moved
+ *          back to the shared free list when it overflows. Blocks may be freed by
+ *          a different thread than the one that allocated them. NULL, or any block
+ *          passed to a pool whose creation failed, is ignored.
+ */
+void free_pool_block(Pool_t* pool, void* block);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Frees every slab owned by the pool, invalidating all of its blocks.
+ *
+ * @return  Returns true if memory was freed, or false if the pool was already empty.
+ */
+bool free_pool(Pool_t* pool);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns a JesterAllocator_t that serves blocks from this pool.
+ *
+ * @details Requests larger than the block size fail, and reallocation only
+ *          succeeds while the new size still fits in a block.
+ */
+const JesterAllocator_t* get_pool_allocator(Pool_t* pool);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+#endif
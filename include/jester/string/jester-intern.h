@@ -0,0 +1,164 @@
+﻿/**
+ * @headerfile jester-intern.h
+ * @brief      String interning pool with dense ids for the Jester stdlib.
+ *
+ * @details    Interning maps every distinct byte string to one canonical copy
+ *             and a dense InternId_t (0, 1, 2, ... in order of first sight).
+ *             Interned strings can then be compared, hashed, and joined on as
+ *             plain integers instead of with strcmp().
+ *
+ *             - Bytes are copied once into arena chunks (NUL-terminated) and
+ *               never move, so get_intern_string() pointers stay valid for the
+ *               pool's lifetime.
+ *             - Lookups go through a ConcurrentMap_t and never take a lock;
+ *               only a string seen for the first time takes the pool mutex.
+ *             - Id -> string goes through a SegmentedArray_t, whose elements
+ *               never move either, so it is also lock-free.
+ *
+ *             Example:
+ *             @code
+ *             InternPool_t names = create_intern_pool();
+ *             InternId_t a = intern_cstr(&names, "request.latency");
+ *             InternId_t b = intern_cstr(&names, "request.latency");  // a == b
+ *             puts(get_intern_string(&names, a));
+ *             free_intern_pool(&names);
+ *             @endcode
+ *
+ * @copyright  GPL-3.0
+ * @author     Case Presley
+ * @date       10-17-2026
+ */
+
+#ifndef JESTER_STDLIB_JESTER_INTERN_H
+#define JESTER_STDLIB_JESTER_INTERN_H
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include <pthread.h>                                         // |
+#include <stdatomic.h>                                       // |
+#include <stdbool.h>                                         // |
+#include <stdint.h>                                          // |
+#include "jester/datastructs/array/jester-segmented-array.h" // |
+#include "jester/datastructs/map/jester-concurrent-map.h"    // |
+#include "jester/memory/jester-arena.h"                      // |
+#include "jester/string/jester-string.h"                     // |
+//--------------------------------------------------------------┙
+
+#define JESTER_INTERN_INVALID_ID ((InternId_t)UINT32_MAX)
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief  Dense id of an interned string.
+ */
+typedef uint32_t InternId_t;
+
+/**
+ * @struct InternPool
+ * @brief  Thread-safe string interning pool.
+ *
+ * @var    InternPool::index
+ *         Map from string (a StringView_t into the arena) to id.
+ *
+ * @var    InternPool::strings
+ *         StringView_t per id, in id order.
+ *
+ * @var    InternPool::bytes
+ *         Arena holding the NUL-terminated string bytes.
+ *
+ * @var    InternPool::lock
+ *         Mutex serializing the first interning of a string.
+ *
+ * @var    InternPool::count
+ *         Number of published ids.
+ */
+typedef struct InternPool
+{
+    ConcurrentMap_t index;
+    SegmentedArray_t strings;
+    Arena_t bytes;
+    pthread_mutex_t lock;
+    _Atomic uint32_t count;
+} InternPool_t;
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates an empty intern pool on the global heap.
+ *
+ * @return  An initialized InternPool_t.
+ *
+ * @note    The pool MUST be freed later using free_intern_pool().
+ */
+InternPool_t create_intern_pool(void);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates an empty intern pool whose map, id table, and arena chunks come from @p allocator.
+ *
+ * @param   allocator  Thread-safe allocator to use, or NULL for the global heap.
+ */
+InternPool_t create_intern_pool_with_allocator(const JesterAllocator_t* allocator);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the id of @p view, interning a copy of it first if it is new.
+ *
+ * @return  The string's id, or JESTER_INTERN_INVALID_ID if a memory allocation fails.
+ */
+InternId_t intern_string(InternPool_t* pool, StringView_t view);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   intern_string() for a NUL-terminated string.
+ */
+InternId_t intern_cstr(InternPool_t* pool, const char* cstr);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the id of @p view without interning it.
+ *
+ * @return  The string's id, or JESTER_INTERN_INVALID_ID if it was never interned.
+ */
+InternId_t find_intern_string(const InternPool_t* pool, StringView_t view);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the canonical NUL-terminated copy of an interned string.
+ *
+ * @return  Pointer valid until the pool is freed, or NULL for an unknown id.
+ */
+const char* get_intern_string(const InternPool_t* pool, InternId_t id);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns a view of an interned string (empty for an unknown id).
+ */
+StringView_t get_intern_view(const InternPool_t* pool, InternId_t id);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the number of distinct strings interned so far.
+ */
+size_t get_intern_pool_count(const InternPool_t* pool);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Frees every interned string and the pool's tables.
+ *
+ * @note    Not thread-safe: no other thread may use the pool during or after this call.
+ *
+ * @return  Returns true if memory was freed, or false if nothing was allocated.
+ */
+bool free_intern_pool(InternPool_t* pool);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,377 @@
+﻿/**
+ * @headerfile jester-string.h
+ * @brief      Owned strings, string builders, and string views for the Jester stdlib.
+ *
+ * @details    Three complementary types:
+ *             - StringView_t: a non-owning (pointer, size) slice. Not
+ *               necessarily NUL-terminated, never allocates, passed by value.
+ *             - String_t: an owned, NUL-terminated string with small-string
+ *               optimization. Up to JESTER_STRING_INLINE_CAPACITY bytes live
+ *               inside the struct itself, so short strings (names, keys, ids)
+ *               never touch the heap.
+ *             - StringBuilder_t: a growable buffer with amortized O(1) append
+ *               and printf-style formatting straight into its spare capacity,
+ *               for assembling messages without fixed-size char[] buffers.
+ *
+ *             Example:
+ *             @code
+ *             StringBuilder_t b = create_string_builder(0);
+ *             append_string_builder_format(&b, "%s:%d", file, line);
+ *             String_t where = build_string(&b);
+ *             free_string_builder(&b);
+ *             puts(get_string_data(&where));
+ *             free_string(&where);
+ *             @endcode
+ *
+ * @copyright  GPL-3.0
+ * @author     Case Presley
+ * @date       10-17-2026
+ */
+
+#ifndef JESTER_STDLIB_JESTER_STRING_H
+#define JESTER_STDLIB_JESTER_STRING_H
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include <stdarg.h>                                        // |
+#include <stdbool.h>                                       // |
+#include <stddef.h>                                        // |
+#include <stdint.h>                                        // |
+#include "jester/memory/jester-allocator.h"                // |
+//------------------------------------------------------------┙
+
+#define JESTER_STRING_INLINE_CAPACITY       23
+#define JESTER_STRING_BUILDER_MIN_CAPACITY  64
+
+// --- view of a string literal without a strlen() call ---
+#define JESTER_STRING_VIEW_LITERAL(literal) ((StringView_t){(literal), sizeof(literal) - 1})
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @struct StringView
+ * @brief  Non-owning slice of bytes.
+ *
+ * @var    StringView::data
+ *         First byte of the slice, may be NULL when size is 0.
+ *
+ * @var    StringView::size
+ *         Number of bytes in the slice.
+ */
+typedef struct StringView
+{
+    const char* data;
+    size_t size;
+} StringView_t;
+
+/**
+ * @struct String
+ * @brief  Owned NUL-terminated string with small-string optimization.
+ *
+ * @var    String::heap
+ *         Heap buffer and its capacity (excluding the NUL) once the string outgrows the struct.
+ *
+ * @var    String::small
+ *         Inline bytes, including the NUL, while the string fits.
+ *
+ * @var    String::size
+ *         Length in bytes; the top bit marks heap storage. Use get_string_size().
+ */
+typedef struct String
+{
+    union
+    {
+        struct
+        {
+            char* data;
+            size_t capacity;
+        } heap;
+        char small[JESTER_STRING_INLINE_CAPACITY + 1];
+    };
+    size_t size;
+} String_t;
+
+/**
+ * @struct StringBuilder
+ * @brief  Growable character buffer for assembling strings.
+ *
+ * @var    StringBuilder::data
+ *         Buffer, always NUL-terminated once allocated.
+ *
+ * @var    StringBuilder::size
+ *         Number of bytes appended so far.
+ *
+ * @var    StringBuilder::capacity
+ *         Bytes available before the buffer must grow, excluding the NUL.
+ *
+ * @var    StringBuilder::allocator
+ *         Allocator that owns the buffer. NULL selects the global heap.
+ */
+typedef struct StringBuilder
+{
+    char* data;
+    size_t size;
+    size_t capacity;
+    const JesterAllocator_t* allocator;
+} StringBuilder_t;
+
+// ---------------------------------------------------------------------------------------------------------------
+// String views
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates a view of a NUL-terminated string (NULL gives an empty view).
+ */
+StringView_t create_string_view(const char* cstr);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the part of @p view starting at @p start, at most @p length bytes long.
+ *
+ * @details Out-of-range arguments are clamped, so the result is always a valid (possibly empty) view.
+ */
+StringView_t slice_string_view(StringView_t view, size_t start, size_t length);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns true if both views hold the same bytes.
+ */
+bool equals_string_view(StringView_t a, StringView_t b);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns true if @p view begins with @p prefix.
+ */
+bool starts_with_string_view(StringView_t view, StringView_t prefix);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the index of the first @p c in @p view, or SIZE_MAX if there is none.
+ */
+size_t find_string_view(StringView_t view, char c);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Hashes the bytes of @p view with jester_hash().
+ */
+uint64_t hash_string_view(StringView_t view);
+
+// ---------------------------------------------------------------------------------------------------------------
+// Owned strings
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates a string holding a copy of @p cstr (NULL gives an empty string).
+ *
+ * @return  An initialized String_t. It is empty if a memory allocation failed.
+ *
+ * @note    The string MUST be freed later using free_string().
+ */
+String_t create_string(const char* cstr);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates a string holding a copy of the bytes in @p view.
+ *
+ * @return  An initialized String_t. It is empty if a memory allocation failed.
+ */
+String_t create_string_from_view(StringView_t view);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the string's NUL-terminated bytes.
+ *
+ * @details Valid until the string is next modified or freed. For an inline string
+ *          the pointer refers into the struct, so it also moves when the struct is copied.
+ */
+const char* get_string_data(const String_t* string);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the string's length in bytes.
+ */
+size_t get_string_size(const String_t* string);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns true while the string is stored inside the struct.
+ */
+bool is_string_inline(const String_t* string);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns a view of the whole string.
+ */
+StringView_t get_string_view(const String_t* string);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Ensures the string can hold @p capacity bytes without reallocating.
+ *
+ * @return  Returns true on success, or false if a memory allocation fails.
+ */
+bool reserve_string(String_t* string, size_t capacity);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Appends the bytes of @p view.
+ *
+ * @return  Returns true on success, or false if a memory allocation fails.
+ */
+bool append_string(String_t* string, StringView_t view);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Appends printf-style formatted text.
+ *
+ * @return  Returns true on success, or false on a formatting error or failed allocation
+ *          (the string is left unchanged).
+ */
+bool append_string_format(String_t* string, const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Empties the string, keeping any heap buffer for reuse.
+ *
+ * @return  Always returns true to indicate the operation completed successfully.
+ */
+bool clear_string(String_t* string);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Copies @p source into @p destination, which must be freed or never initialized.
+ *
+ * @return  Returns true on success, or false if a memory allocation fails.
+ */
+bool copy_string(const String_t* source, String_t* destination);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Frees any heap buffer and resets the string to empty.
+ *
+ * @return  Returns true if memory was freed, or false if the string was inline.
+ */
+bool free_string(String_t* string);
+
+// ---------------------------------------------------------------------------------------------------------------
+// String builders
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates an empty builder with room for @p capacity bytes (0 allocates lazily).
+ *
+ * @note    The builder MUST be freed later using free_string_builder().
+ */
+StringBuilder_t create_string_builder(size_t capacity);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Creates an empty builder that allocates from @p allocator.
+ *
+ * @param   capacity   Initial capacity in bytes, 0 allocates lazily.
+ * @param   allocator  Allocator to use, or NULL for the global heap.
+ */
+StringBuilder_t create_string_builder_with_allocator(size_t capacity, const JesterAllocator_t* allocator);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Ensures the builder can hold @p capacity bytes without reallocating.
+ *
+ * @return  Returns true on success, or false if a memory allocation fails.
+ */
+bool reserve_string_builder(StringBuilder_t* builder, size_t capacity);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Appends the bytes of @p view.
+ *
+ * @return  Returns true on success, or false if a memory allocation fails.
+ */
+bool append_string_builder(StringBuilder_t* builder, StringView_t view);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Appends a single character.
+ *
+ * @return  Returns true on success, or false if a memory allocation fails.
+ */
+bool append_string_builder_char(StringBuilder_t* builder, char c);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Appends printf-style formatted text.
+ *
+ * @details Formats straight into the spare capacity; only output that does not
+ *          fit is formatted a second time after growing.
+ *
+ * @return  Returns true on success, or false on a formatting error or failed allocation
+ *          (the builder is left unchanged).
+ */
+bool append_string_builder_format(StringBuilder_t* builder, const char* format, ...)
+    __attribute__((format(printf, 2, 3)));
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   va_list variant of append_string_builder_format().
+ */
+bool append_string_builder_vformat(StringBuilder_t* builder, const char* format, va_list args)
+    __attribute__((format(printf, 2, 0)));
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns a view of the builder's contents, valid until the next append.
+ */
+StringView_t get_string_builder_view(const StringBuilder_t* builder);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Copies the builder's contents into a new String_t.
+ *
+ * @return  An initialized String_t. It is empty if a memory allocation failed.
+ */
+String_t build_string(const StringBuilder_t* builder);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Empties the builder, keeping its buffer for reuse.
+ *
+ * @return  Always returns true to indicate the operation completed successfully.
+ */
+bool clear_string_builder(StringBuilder_t* builder);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Frees the buffer and resets the builder to an empty state.
+ *
+ * @return  Returns true if memory was freed, or false if nothing was allocated.
+ */
+bool free_string_builder(StringBuilder_t* builder);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,97 @@
+﻿/**
+ * @headerfile jester-time.h
+ * @brief      High-resolution clock subsystem for the Jester stdlib.
+ *
+ * @details    Reads the invariant TSC directly and converts cycles to
+ *             nanoseconds with a calibrated fixed-point multiplier, so that
+ *             taking a timestamp costs a handful of cycles instead of a
+ *             clock_gettime() call. On machines without an invariant TSC
+ *             every function falls back to clock_gettime().
+ *
+ * @copyright  GPL-3.0
+ * @author     Case Presley
+ * @date       10-16-2026
+ */
+
+#ifndef JESTER_STDLIB_JESTER_TIME_H
+#define JESTER_STDLIB_JESTER_TIME_H
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include <stdbool.h>                                       // |
+#include <stdint.h>                                        // |
+//------------------------------------------------------------┙
+
+#define JESTER_TIME_RESYNC_INTERVAL_MS 1000
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Calibrates the clock and starts the background re-synchronization thread.
+ *
+ * @details Measures the TSC frequency against CLOCK_MONOTONIC and publishes the
+ *          conversion parameters. Every JESTER_TIME_RESYNC_INTERVAL_MS the background
+ *          thread re-anchors the conversion against CLOCK_MONOTONIC/CLOCK_REALTIME so
+ *          drift and wall-clock steps never accumulate. Calling this is optional,
+ *          the first call to any clock function initializes lazily. Safe to call
+ *          more than once.
+ *
+ * @return  Returns true if the invariant TSC is in use, or false if the clock
+ *          falls back to clock_gettime().
+ */
+bool jester_time_init(void);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Stops the background re-synchronization thread.
+ *
+ * @details The clock keeps working with the last published parameters.
+ */
+void jester_time_shutdown(void);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Re-anchors the clock against CLOCK_MONOTONIC now, as the background thread does.
+ *
+ * @details Never steps the clock backwards: any error is slewed out by the next
+ *          JESTER_TIME_RESYNC_INTERVAL_MS. Does nothing without an invariant TSC.
+ */
+void jester_time_resync(void);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the raw cycle counter.
+ *
+ * @return  The current TSC value, or monotonic nanoseconds when no invariant TSC exists.
+ */
+uint64_t jester_cycles(void);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns the calibrated frequency of jester_cycles() in ticks per second.
+ */
+uint64_t jester_cycles_per_second(void);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns monotonic time in nanoseconds, on the CLOCK_MONOTONIC time base.
+ */
+uint64_t jester_now_ns(void);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+/**
+ * @brief   Returns wall-clock time in nanoseconds since the Unix epoch.
+ *
+ * @details Derived from jester_now_ns() plus the CLOCK_REALTIME offset captured at
+ *          the last re-synchronization.
+ */
+uint64_t jester_wall_ns(void);
+
+// ---------------------------------------------------------------------------------------------------------------
+
+#endif
@@ -4,9 +4,17 @@
  *
  * @details   Provides internal logic for creation, resizing, and management of
  *            dynamically allocated, type-agnostic arrays. This implementation
- *            supports push, pop, clear, shrink, reserve, copy, and free operations.
- *            All allocation is currently handled via malloc/realloc/free, but will
- *            later be replaced by Jester’s custom memory subsystem.
+ *            supports push, pop, clear, shrink, reserve, copy, and free operations,
+ *            as well as bulk append, range insert/erase, and swap removal.
+ *            All allocation goes through the array's JesterAllocator_t, which
+ *            defaults to malloc/realloc/free when none is given. On Linux,
+ *            default-allocator buffers of JESTER_DYNAMIC_ARRAY_HUGE_THRESHOLD
+ *            bytes or more live in anonymous mappings and grow with mremap(),
+ *            which moves page table entries instead of copying the contents.
+ *            Whether a buffer is mapped follows from its byte size alone, so
+ *            no extra bookkeeping is needed. Arrays created with an alignment
+ *            above what the allocator guarantees over-allocate and keep the
+ *            offset to the raw block just in front of the data.
  *
  * @copyright GPL-3.0
  * @author    Case Presley
@@ -16,29 +24,253 @@
  *            jester-utils is complete.
  */
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE  // mremap()
+#endif
+
 //-------------------- INCLUDE FILES -------------------------┑
 #include "jester/datastructs/array/jester-dynamic-array.h" // |
+#include "jester/memory/jester-allocator.h"                // |
+#include <stddef.h>                                        // |
 #include <stdlib.h>                                        // |
+#include <stdint.h>                                        // |
 #include <string.h>                                        // |
+#ifdef __linux__                                           // |
+#include <sys/mman.h>                                      // |
+#endif                                                     // |
 //------------------------------------------------------------┙
 
+// ---------------------------------------------------------------------------------------------------------------
+// Storage: the array's allocator, or anonymous mappings for huge default-allocator buffers
+// ---------------------------------------------------------------------------------------------------------------
+
+#ifdef __linux__
+
+static bool is_mapped_storage(const DynamicArray_t* a, const size_t bytes)
+{
+    return bytes >= JESTER_DYNAMIC_ARRAY_HUGE_THRESHOLD
+           && a->alignment <= JESTER_DYNAMIC_ARRAY_PAGE_SIZE  // mappings are only page aligned
+           && (a->allocator == NULL || a->allocator == jester_heap_allocator());
+}
+
+static void advise_huge_pages(const DynamicArray_t* a, void* ptr, const size_t bytes)
+{
+#ifdef MADV_HUGEPAGE
+    if (a->huge_pages) madvise(ptr, bytes, MADV_HUGEPAGE);  // best effort, THP may be disabled
+#else
+    (void)a;
+    (void)ptr;
+    (void)bytes;
+#endif
+}
+
+static void* map_storage(const DynamicArray_t* a, const size_t bytes)
+{
+    void* ptr = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) return NULL;
+
+    advise_huge_pages(a, ptr, bytes);
+    return ptr;
+}
+
+#endif
+
+// --- true if the allocator alone cannot guarantee the array's alignment ---
+static bool is_overaligned(const DynamicArray_t* a)
+{
+    return a->alignment > _Alignof(max_align_t);
+}
+
+// --- raw block size for an over-aligned buffer: room for the offset and the worst-case padding ---
+static size_t overaligned_size(const DynamicArray_t* a, const size_t bytes)
+{
+    return bytes + sizeof(size_t) + a->alignment - 1;
+}
+
+static void* allocate_storage(const DynamicArray_t* a, const size_t bytes)
+{
+#ifdef __linux__
+    if (is_mapped_storage(a, bytes)) return map_storage(a, bytes);
+#endif
+    if (!is_overaligned(a)) return jester_allocate(a->allocator, bytes);
+
+    // --- over-allocate, align past the offset slot, then record the offset ---
+    if (bytes > SIZE_MAX - sizeof(size_t) - a->alignment) return NULL;
+    unsigned char* raw = jester_allocate(a->allocator, overaligned_size(a, bytes));
+    if (raw == NULL) return NULL;
+
+    const uintptr_t start   = (uintptr_t)raw + sizeof(size_t);
+    const uintptr_t aligned = (start + a->alignment - 1) & ~(uintptr_t)(a->alignment - 1);
+    const size_t offset     = (size_t)(aligned - (uintptr_t)raw);
+    memcpy((unsigned char*)aligned - sizeof(size_t), &offset, sizeof(size_t));
+
+    return (void*)aligned;
+}
+
+static void deallocate_storage(const DynamicArray_t* a, void* ptr, const size_t bytes)
+{
+#ifdef __linux__
+    if (ptr && is_mapped_storage(a, bytes))
+    {
+        munmap(ptr, bytes);
+        return;
+    }
+#endif
+    if (ptr == NULL || !is_overaligned(a))
+    {
+        jester_deallocate(a->allocator, ptr, bytes);
+        return;
+    }
+
+    // --- step back to the raw block using the stored offset ---
+    size_t offset;
+    memcpy(&offset, (unsigned char*)ptr - sizeof(size_t), sizeof(size_t));
+    jester_deallocate(a->allocator, (unsigned char*)ptr - offset, overaligned_size(a, bytes));
+}
+
+static void* reallocate_storage(const DynamicArray_t* a, void* ptr, const size_t old_bytes, const size_t new_bytes)
+{
+#ifdef __linux__
+    const bool old_mapped = ptr != NULL && is_mapped_storage(a, old_bytes);
+    const bool new_mapped = is_mapped_storage(a, new_bytes);
+
+    // --- mapped to mapped: remap the pages, no bytes are copied ---
+    if (old_mapped && new_mapped)
+    {
+        void* moved = mremap(ptr, old_bytes, new_bytes, MREMAP_MAYMOVE);
+        if (moved == MAP_FAILED) return NULL;
+
+        if (new_bytes > old_bytes) advise_huge_pages(a, moved, new_bytes);
+        return moved;
+    }
+
+    // --- crossing the threshold: one copy between heap and mapping ---
+    if (old_mapped || new_mapped)
+    {
+        void* fresh = allocate_storage(a, new_bytes);
+        if (fresh == NULL) return NULL;
+
+        if (ptr) memcpy(fresh, ptr, old_bytes < new_bytes ? old_bytes : new_bytes);
+        deallocate_storage(a, ptr, old_bytes);
+        return fresh;
+    }
+#endif
+    if (!is_overaligned(a)) return jester_reallocate(a->allocator, ptr, old_bytes, new_bytes);
+
+    // --- realloc could drop the alignment: allocate, copy, release ---
+    void* fresh = allocate_storage(a, new_bytes);
+    if (fresh == NULL) return NULL;
+
+    if (ptr) memcpy(fresh, ptr, old_bytes < new_bytes ? old_bytes : new_bytes);
+    deallocate_storage(a, ptr, old_bytes);
+    return fresh;
+}
+
+//-----------------------------------------------------┑
+// Next capacity under the array's growth policy, or   |
+// 0 if it would overflow                              |
+//-----------------------------------------------------┙
+static size_t next_dynamic_array_capacity(const DynamicArray_t* a)
+{
+    const size_t capacity = a->capacity;
+
+    // --- an empty buffer starts at the minimum capacity ---
+    if (capacity == 0)
+    {
+        const size_t fixed = a->growth == DYNAMIC_ARRAY_GROW_FIXED ? a->growth_increment : 0;
+        return fixed > JESTER_DYNAMIC_ARRAY_MIN_CAPACITY ? fixed : JESTER_DYNAMIC_ARRAY_MIN_CAPACITY;
+    }
+
+    switch (a->growth)
+    {
+        case DYNAMIC_ARRAY_GROW_HALF:
+            return capacity > SIZE_MAX - capacity / 2 - 1 ? 0 : capacity + capacity / 2 + 1;
+
+        case DYNAMIC_ARRAY_GROW_PAGE:
+        {
+            // --- grow by 1.5x, then use the whole of the last page ---
+            const size_t grown = capacity > SIZE_MAX - capacity / 2 - 1 ? 0 : capacity + capacity / 2 + 1;
+            if (grown == 0 || a->element_size == 0 || grown > SIZE_MAX / a->element_size) return grown;
+
+            const size_t bytes = grown * a->element_size;
+            if (bytes > SIZE_MAX - JESTER_DYNAMIC_ARRAY_PAGE_SIZE) return grown;
+            const size_t page  = JESTER_DYNAMIC_ARRAY_PAGE_SIZE;
+            const size_t paged = (bytes + page - 1) & ~(page - 1);
+            return paged / a->element_size;
+        }
+
+        case DYNAMIC_ARRAY_GROW_FIXED:
+            return capacity > SIZE_MAX - a->growth_increment ? 0 : capacity + a->growth_increment;
+
+        case DYNAMIC_ARRAY_GROW_DOUBLE:
+        default:
+            return capacity > SIZE_MAX / 2 ? 0 : capacity * 2;
+    }
+}
+
+//-----------------------------------------------------┑
+// Grows the buffer once so that it can hold at least  |
+// min_capacity elements, following the growth policy  |
+//-----------------------------------------------------┙
+static bool grow_dynamic_array(DynamicArray_t* a, const size_t min_capacity)
+{
+    // --- nothing to do if the buffer is already large enough ---
+    if (a->capacity >= min_capacity) return true;
+
+    // --- pick the larger of the next growth step and the required capacity ---
+    const size_t next         = next_dynamic_array_capacity(a);
+    const size_t new_capacity = next > min_capacity ? next : min_capacity;
+
+    return reserve_dynamic_array(a, new_capacity);
+}
+
 //-----------------------------------------------------┑
 // TODO: Add assertions when utils is integrated.      |
 // For now, return booleans for simple success/failure |
 //-----------------------------------------------------┙
 struct DynamicArray create_dynamic_array(const size_t element_size, const size_t capacity)
+{
+    return create_dynamic_array_with_allocator(element_size, capacity, NULL);
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+struct DynamicArray create_dynamic_array_with_allocator(const size_t element_size, const size_t capacity,
+                                                        const JesterAllocator_t* allocator)
+{
+    return create_dynamic_array_aligned(element_size, capacity, 0, allocator);
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+struct DynamicArray create_dynamic_array_aligned(const size_t element_size, const size_t capacity,
+                                                 const size_t alignment, const JesterAllocator_t* allocator)
 {
     DynamicArray_t dynamic_array = {};  // initialize to defaults
 
+    // --- validate alignment (0 or a power of two) ---
+    if ((alignment & (alignment - 1)) != 0) return dynamic_array;
+
+    dynamic_array.allocator    = allocator;
+    dynamic_array.element_size = element_size;
+    dynamic_array.alignment    = alignment;
+
+    // --- an empty array allocates lazily on the first push ---
+    if (capacity == 0) return dynamic_array;
+
     // --- allocate initial buffer ---
+    if (element_size != 0 && capacity > SIZE_MAX / element_size) return dynamic_array;
     const size_t total_byte = element_size * capacity;
-    dynamic_array.data      = malloc(total_byte);
+    dynamic_array.data      = allocate_storage(&dynamic_array, total_byte);
     if (dynamic_array.data == NULL) return dynamic_array;
 
     // --- initialize fields ---
-    dynamic_array.element_size = element_size;
-    dynamic_array.count        = 0;
-    dynamic_array.capacity     = capacity;
+    dynamic_array.count    = 0;
+    dynamic_array.capacity = capacity;
 
     return dynamic_array;
 }
@@ -50,21 +282,9 @@ struct DynamicArray create_dynamic_array(const size_t element_size, const size_t
 bool push_dynamic_array(DynamicArray_t* a, const void* data)
 {
     // --- grow capacity if full ---
-    if (a->count == a->capacity)
+    if (a->count == a->capacity && !grow_dynamic_array(a, a->count + 1))
     {
-        const size_t new_capacity = a->capacity * 2;                 // double capacity
-        const size_t new_size     = a->element_size * new_capacity;  //
-        void* temp_ptr            = realloc(a->data, new_size);      // attempt to grow the buffer
-
-        if (temp_ptr)
-        {
-            a->data     = temp_ptr;
-            a->capacity = new_capacity;
-        }
-        else
-        {
-            return false;  // reallocation failed
-        }
+        return false;  // reallocation failed
     }
 
     // --- copy new element into array ---
@@ -111,7 +331,7 @@ bool free_dynamic_array(DynamicArray_t* a)
     // --- free the allocated memory, if any ---
     if (a->data != NULL)
     {
-        free(a->data);
+        deallocate_storage(a, a->data, a->element_size * a->capacity);
         a->data = NULL;
     }
     else
@@ -140,8 +360,10 @@ bool reserve_dynamic_array(DynamicArray_t* a, size_t new_capacity)
     }
 
     // --- attempt to reallocate to the new capacity ---
+    if (a->element_size != 0 && new_capacity > SIZE_MAX / a->element_size) return false;
     const size_t new_size = new_capacity * a->element_size;
-    void* temp_ptr        = realloc(a->data, new_size);
+    const size_t old_size = a->capacity * a->element_size;
+    void* temp_ptr        = reallocate_storage(a, a->data, old_size, new_size);
 
     if (temp_ptr)
     {
@@ -160,19 +382,21 @@ bool reserve_dynamic_array(DynamicArray_t* a, size_t new_capacity)
 //-----------------------------------------------------┙
 bool shrink_dynamic_array(DynamicArray_t* a)
 {
-    // --- handle empty array: free all memory and reset fields ---
+    // --- handle empty array: free all memory, keep element size and growth policy ---
     if (a->count == 0)
     {
-        free(a->data);
-        a->data         = NULL;
-        a->capacity     = 0;
-        a->element_size = 0;
-        return false;  // nothing to shrink
+        if (a->data == NULL) return false;  // nothing to shrink
+
+        deallocate_storage(a, a->data, a->element_size * a->capacity);
+        a->data     = NULL;
+        a->capacity = 0;
+        return true;
     }
 
     // --- shrink buffer to match current element count ---
     const size_t new_size = a->element_size * a->count;
-    void* temp_ptr = realloc(a->data, new_size);
+    const size_t old_size = a->element_size * a->capacity;
+    void* temp_ptr = reallocate_storage(a, a->data, old_size, new_size);
 
     if (temp_ptr)
     {
@@ -217,12 +441,21 @@ bool pop_dynamic_array(DynamicArray_t* a, void* dst)
 bool copy_dynamic_array(const DynamicArray_t* src, DynamicArray_t* dst)
 {
     // --- copy metadata fields ---
-    dst->count        = src->count;
-    dst->element_size = src->element_size;
-    dst->capacity     = src->capacity;
+    dst->count            = src->count;
+    dst->element_size     = src->element_size;
+    dst->capacity         = src->capacity;
+    dst->allocator        = src->allocator;
+    dst->growth           = src->growth;
+    dst->growth_increment = src->growth_increment;
+    dst->huge_pages       = src->huge_pages;
+    dst->alignment        = src->alignment;
 
-    // --- allocate new buffer for destination ---
-    dst->data = malloc(src->element_size * src->capacity);
+    // --- an empty source leaves an empty (but usable) destination ---
+    dst->data = NULL;
+    if (src->capacity == 0) return false;
+
+    // --- allocate new buffer for destination (from the source's allocator) ---
+    dst->data = allocate_storage(dst, src->element_size * src->capacity);
     if (dst->data == NULL)
     {
         // --- allocation failed: reset destination to safe defaults ---
@@ -242,3 +475,104 @@ bool copy_dynamic_array(const DynamicArray_t* src, DynamicArray_t* dst)
     // --- source had no data to copy ---
     return false;
 }
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool append_dynamic_array(DynamicArray_t* a, const void* src, const size_t n)
+{
+    // --- nothing to append ---
+    if (n == 0) return true;
+
+    // --- grow at most once for the whole block ---
+    if (n > SIZE_MAX - a->count || !grow_dynamic_array(a, a->count + n)) return false;
+
+    // --- copy the whole block in one go ---
+    char* destination = (char*)a->data + (a->count * a->element_size);
+    memcpy(destination, src, n * a->element_size);
+    a->count += n;
+
+    return true;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool insert_dynamic_array_range(DynamicArray_t* a, const size_t index, const void* src, const size_t n)
+{
+    // --- validate index (inserting at count appends) ---
+    if (index > a->count) return false;
+    if (n == 0) return true;
+
+    // --- grow at most once for the whole block ---
+    if (n > SIZE_MAX - a->count || !grow_dynamic_array(a, a->count + n)) return false;
+
+    // --- open a gap by shifting the tail back, then fill it ---
+    char* gap = (char*)a->data + (index * a->element_size);
+    memmove(gap + (n * a->element_size), gap, (a->count - index) * a->element_size);
+    memcpy(gap, src, n * a->element_size);
+    a->count += n;
+
+    return true;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool erase_dynamic_array_range(DynamicArray_t* a, const size_t index, const size_t n)
+{
+    // --- validate range ---
+    if (index > a->count || n > a->count - index) return false;
+    if (n == 0) return true;
+
+    // --- close the gap by shifting the tail forward ---
+    char* gap = (char*)a->data + (index * a->element_size);
+    memmove(gap, gap + (n * a->element_size), (a->count - index - n) * a->element_size);
+    a->count -= n;
+
+    return true;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool swap_remove_dynamic_array(DynamicArray_t* a, const size_t index)
+{
+    // --- validate index ---
+    if (index >= a->count) return false;
+
+    // --- move the last element into the hole ---
+    a->count--;
+    if (index != a->count)
+    {
+        char* hole       = (char*)a->data + (index * a->element_size);
+        const char* last = (char*)a->data + (a->count * a->element_size);
+        memcpy(hole, last, a->element_size);
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool set_dynamic_array_growth(DynamicArray_t* a, const DynamicArrayGrowth_t growth, const size_t increment)
+{
+    // --- a fixed policy needs a step to grow by ---
+    if (growth == DYNAMIC_ARRAY_GROW_FIXED && increment == 0) return false;
+
+    a->growth           = growth;
+    a->growth_increment = growth == DYNAMIC_ARRAY_GROW_FIXED ? increment : 0;
+
+    return true;
+}
+
+void set_dynamic_array_huge_pages(DynamicArray_t* a, const bool enabled)
+{
+    a->huge_pages = enabled;
+}
\ No newline at end of file
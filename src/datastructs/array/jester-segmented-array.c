@@ -0,0 +1,168 @@
+﻿/**
+ * @file      jester-segmented-array.c
+ * @brief     Implementation of the segmented array for the Jester stdlib.
+ *
+ * @details   With a first segment of B elements, segment k holds B << k
+ *            elements and starts at index B * (2^k - 1). Adding B to an index
+ *            therefore makes the segment number the position of its highest set
+ *            bit (minus log2 B), and the offset the remaining low bits.
+ *
+ * @copyright GPL-3.0
+ * @author    Case Presley
+ * @date      10-17-2026
+ */
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include "jester/datastructs/array/jester-segmented-array.h" // |
+#include <stdint.h>                                          // |
+#include <string.h>                                          // |
+//--------------------------------------------------------------┙
+
+#define FIRST_SEGMENT_SHIFT ((size_t)__builtin_ctzll(JESTER_SEGMENTED_ARRAY_FIRST_SEGMENT))
+
+// --- number of elements in segment k ---
+static size_t segment_length(const size_t k)
+{
+    return (size_t)JESTER_SEGMENTED_ARRAY_FIRST_SEGMENT << k;
+}
+
+// --- split an index into its segment and the offset inside it ---
+static void locate_element(const size_t index, size_t* segment, size_t* offset)
+{
+    const size_t biased = index + JESTER_SEGMENTED_ARRAY_FIRST_SEGMENT;
+    const size_t top    = (size_t)(63 - __builtin_clzll((unsigned long long)biased));
+
+    *segment = top - FIRST_SEGMENT_SHIFT;
+    *offset  = biased - ((size_t)1 << top);
+}
+
+// --- allocate the next segment ---
+static bool add_segment(SegmentedArray_t* a)
+{
+    const size_t k = a->segment_count;
+    if (k == JESTER_SEGMENTED_ARRAY_MAX_SEGMENTS) return false;  // segment table full
+
+    const size_t length = segment_length(k);
+    if (a->element_size != 0 && length > SIZE_MAX / a->element_size) return false;
+
+    void* segment = jester_allocate(a->allocator, length * a->element_size);
+    if (segment == NULL) return false;
+
+    a->segments[k] = segment;
+    a->segment_count++;
+    return true;
+}
+
+SegmentedArray_t create_segmented_array_with_allocator(const size_t element_size, const JesterAllocator_t* allocator)
+{
+    SegmentedArray_t segmented_array = {};  // initialize to defaults
+    segmented_array.element_size     = element_size;
+    segmented_array.allocator        = allocator;
+    return segmented_array;
+}
+
+SegmentedArray_t create_segmented_array(const size_t element_size)
+{
+    return create_segmented_array_with_allocator(element_size, NULL);
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return NULL on failure                     |
+//-----------------------------------------------------┙
+void* push_segmented_array(SegmentedArray_t* a, const void* data)
+{
+    size_t segment, offset;
+    locate_element(a->count, &segment, &offset);
+
+    // --- the next slot is the first of a segment not allocated yet ---
+    if (segment == a->segment_count && !add_segment(a)) return NULL;
+
+    char* destination = (char*)a->segments[segment] + (offset * a->element_size);
+    memcpy(destination, data, a->element_size);
+    a->count++;
+
+    return destination;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return NULL when index is out of bounds    |
+//-----------------------------------------------------┙
+void* get_segmented_array_element(const SegmentedArray_t* a, const size_t index)
+{
+    // --- validate index ---
+    if (index >= a->count) return NULL;
+
+    return get_segmented_array_element_unchecked(a, index);
+}
+
+void* get_segmented_array_element_unchecked(const SegmentedArray_t* a, const size_t index)
+{
+    size_t segment, offset;
+    locate_element(index, &segment, &offset);
+    return (char*)a->segments[segment] + (offset * a->element_size);
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool pop_segmented_array(SegmentedArray_t* a, void* destination)
+{
+    // --- ensure array is not empty ---
+    if (a->count == 0) return false;
+
+    // --- optionally copy the last element out, the segment stays allocated ---
+    if (destination) memcpy(destination, get_segmented_array_element(a, a->count - 1), a->element_size);
+    a->count--;
+
+    return true;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool reserve_segmented_array(SegmentedArray_t* a, const size_t capacity)
+{
+    while (get_segmented_array_capacity(a) < capacity)
+    {
+        if (!add_segment(a)) return false;
+    }
+    return true;
+}
+
+size_t get_segmented_array_capacity(const SegmentedArray_t* a)
+{
+    // --- segments 0..n-1 hold B * (2^n - 1) elements ---
+    return (size_t)JESTER_SEGMENTED_ARRAY_FIRST_SEGMENT * (((size_t)1 << a->segment_count) - 1);
+}
+
+bool clear_segmented_array(SegmentedArray_t* a)
+{
+    // --- mark array as empty (reuse existing segments) ---
+    a->count = 0;
+    return true;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool free_segmented_array(SegmentedArray_t* a)
+{
+    // --- nothing allocated yet ---
+    if (a->segment_count == 0) return false;
+
+    // --- release every segment ---
+    for (size_t k = 0; k < a->segment_count; k++)
+    {
+        jester_deallocate(a->allocator, a->segments[k], segment_length(k) * a->element_size);
+        a->segments[k] = NULL;
+    }
+
+    a->segment_count = 0;
+    a->count         = 0;
+    return true;
+}
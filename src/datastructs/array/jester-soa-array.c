@@ -0,0 +1,204 @@
+﻿/**
+ * @file      jester-soa-array.c
+ * @brief     Implementation of the structure-of-arrays container for the Jester stdlib.
+ *
+ * @details   All columns live in one block, laid out back to back at the
+ *            current capacity with each column rounded up to the column
+ *            alignment. Growing therefore changes every column offset, so a
+ *            resize allocates a fresh block and copies each column across
+ *            rather than reallocating in place.
+ *
+ * @copyright GPL-3.0
+ * @author    Case Presley
+ * @date      10-17-2026
+ */
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include "jester/datastructs/array/jester-soa-array.h"     // |
+#include <stdint.h>                                        // |
+#include <string.h>                                        // |
+//------------------------------------------------------------┙
+
+#define COLUMN_ALIGN(n) \
+    (((n) + JESTER_SOA_ARRAY_COLUMN_ALIGNMENT - 1) & ~(size_t)(JESTER_SOA_ARRAY_COLUMN_ALIGNMENT - 1))
+
+// --- lay out the columns for a capacity, returning the bytes needed or 0 on overflow ---
+static size_t layout_columns(const SoaArray_t* a, const size_t capacity, size_t* offsets)
+{
+    size_t total = 0;
+    for (size_t f = 0; f < a->field_count; f++)
+    {
+        const size_t field_size = a->field_sizes[f];
+        if (field_size != 0 && capacity > (SIZE_MAX / 2) / field_size) return 0;
+
+        offsets[f] = total;
+        total     += COLUMN_ALIGN(field_size * capacity);
+        if (total > SIZE_MAX / 2) return 0;
+    }
+    return total;
+}
+
+// --- raw block size for a column area of the given size: room to align its start ---
+static size_t block_size(const size_t columns_size)
+{
+    return columns_size + JESTER_SOA_ARRAY_COLUMN_ALIGNMENT - 1;
+}
+
+SoaArray_t create_soa_array_with_allocator(const size_t* field_sizes, const size_t field_count,
+                                           const JesterAllocator_t* allocator)
+{
+    SoaArray_t soa_array = {};  // initialize to defaults
+
+    // --- validate the field layout ---
+    if (field_count == 0 || field_count > JESTER_SOA_ARRAY_MAX_FIELDS) return soa_array;
+
+    soa_array.field_count = field_count;
+    soa_array.allocator   = allocator;
+    memcpy(soa_array.field_sizes, field_sizes, field_count * sizeof(size_t));
+
+    return soa_array;
+}
+
+SoaArray_t create_soa_array(const size_t* field_sizes, const size_t field_count)
+{
+    return create_soa_array_with_allocator(field_sizes, field_count, NULL);
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool reserve_soa_array(SoaArray_t* a, const size_t new_capacity)
+{
+    // --- check if the current capacity is sufficient ---
+    if (a->capacity >= new_capacity) return true;
+    if (a->field_count == 0) return false;
+
+    // --- lay out and allocate the new block ---
+    size_t offsets[JESTER_SOA_ARRAY_MAX_FIELDS];
+    const size_t columns_size = layout_columns(a, new_capacity, offsets);
+    if (columns_size == 0) return false;
+
+    void* block = jester_allocate(a->allocator, block_size(columns_size));
+    if (block == NULL) return false;
+    unsigned char* data = (unsigned char*)COLUMN_ALIGN((uintptr_t)block);
+
+    // --- move each column across with one copy ---
+    for (size_t f = 0; f < a->field_count && a->count != 0; f++)
+    {
+        memcpy(data + offsets[f], (unsigned char*)a->data + a->column_offsets[f], a->count * a->field_sizes[f]);
+    }
+
+    // --- release the old block ---
+    if (a->block)
+    {
+        size_t old_offsets[JESTER_SOA_ARRAY_MAX_FIELDS];
+        jester_deallocate(a->allocator, a->block, block_size(layout_columns(a, a->capacity, old_offsets)));
+    }
+
+    a->block    = block;
+    a->data     = data;
+    a->capacity = new_capacity;
+    memcpy(a->column_offsets, offsets, a->field_count * sizeof(size_t));
+
+    return true;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool push_soa_array(SoaArray_t* a, const void* const* fields)
+{
+    // --- grow every column together when full ---
+    if (a->count == a->capacity)
+    {
+        const size_t new_capacity = a->capacity ? a->capacity * 2 : JESTER_SOA_ARRAY_MIN_CAPACITY;
+        if (new_capacity < a->capacity || !reserve_soa_array(a, new_capacity)) return false;
+    }
+
+    // --- write one value into each column ---
+    for (size_t f = 0; f < a->field_count; f++)
+    {
+        unsigned char* destination = (unsigned char*)a->data + a->column_offsets[f] + (a->count * a->field_sizes[f]);
+        if (fields[f]) memcpy(destination, fields[f], a->field_sizes[f]);
+        else memset(destination, 0, a->field_sizes[f]);
+    }
+    a->count++;
+
+    return true;
+}
+
+void* get_soa_array_column(const SoaArray_t* a, const size_t field)
+{
+    if (field >= a->field_count || a->data == NULL) return NULL;
+    return (unsigned char*)a->data + a->column_offsets[field];
+}
+
+void* get_soa_array_field(const SoaArray_t* a, const size_t field, const size_t index)
+{
+    if (field >= a->field_count || index >= a->count) return NULL;
+    return (unsigned char*)a->data + a->column_offsets[field] + (index * a->field_sizes[field]);
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool swap_remove_soa_array(SoaArray_t* a, const size_t index)
+{
+    // --- validate index ---
+    if (index >= a->count) return false;
+
+    // --- move the last record into the hole, column by column ---
+    a->count--;
+    if (index != a->count)
+    {
+        for (size_t f = 0; f < a->field_count; f++)
+        {
+            unsigned char* column = (unsigned char*)a->data + a->column_offsets[f];
+            const size_t size     = a->field_sizes[f];
+            memcpy(column + (index * size), column + (a->count * size), size);
+        }
+    }
+
+    return true;
+}
+
+bool pop_soa_array(SoaArray_t* a)
+{
+    // --- ensure array is not empty ---
+    if (a->count == 0) return false;
+
+    a->count--;
+    return true;
+}
+
+bool clear_soa_array(SoaArray_t* a)
+{
+    // --- mark array as empty (reuse existing block) ---
+    a->count = 0;
+    return true;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool free_soa_array(SoaArray_t* a)
+{
+    // --- nothing allocated yet ---
+    if (a->block == NULL) return false;
+
+    size_t offsets[JESTER_SOA_ARRAY_MAX_FIELDS];
+    jester_deallocate(a->allocator, a->block, block_size(layout_columns(a, a->capacity, offsets)));
+
+    // --- reset to empty, keeping the field layout ---
+    a->block    = NULL;
+    a->data     = NULL;
+    a->count    = 0;
+    a->capacity = 0;
+    memset(a->column_offsets, 0, sizeof(a->column_offsets));
+
+    return true;
+}
@@ -0,0 +1,525 @@
+﻿/**
+ * @file      jester-concurrent-map.c
+ * @brief     Implementation of the sharded concurrent hash map for the Jester stdlib.
+ *
+ * @details   The 64-bit hash is split three ways: bits 40.. pick the shard,
+ *            the top 7 bits become the slot's control tag (with the high bit
+ *            set, so 0 can mean EMPTY), and the low bits pick the home slot.
+ *            Each shard is a linear-probing table with backward-shift deletion,
+ *            kept at most 3/4 full.
+ *
+ *            Writer protocol, with the shard mutex held: bump the sequence to
+ *            odd, fence, modify the table, then publish the even sequence with
+ *            release order. Readers load the sequence (acquire), read, fence,
+ *            and re-check it. Control bytes are read and written atomically;
+ *            keys and values are copied with plain memcpy and any torn copy is
+ *            discarded by the sequence check, as is usual for seqlocks. Growth
+ *            builds the new table privately and publishes it with one atomic
+ *            pointer store, so a reader sees either the old table or a complete
+ *            new one.
+ *
+ * @copyright GPL-3.0
+ * @author    Case Presley
+ * @date      10-17-2026
+ */
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include "jester/datastructs/map/jester-concurrent-map.h"  // |
+#include <string.h>                                        // |
+//------------------------------------------------------------┙
+
+typedef struct ConcurrentMapTable
+{
+    struct ConcurrentMapTable* next_retired;
+    size_t capacity;
+    size_t bytes;  // total bytes including this header
+    uint8_t* control;
+    unsigned char* slots;
+} ConcurrentMapTable_t;
+
+#define TABLE_HEADER_SIZE 64
+#define CACHE_LINE        64
+#define CONTROL_EMPTY     ((uint8_t)0)
+
+enum ProbeResult
+{
+    PROBE_MISS,
+    PROBE_HIT,
+    PROBE_TORN  // a writer ran during the probe, retry
+};
+
+static void cpu_relax(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+}
+
+// --- shard, control tag, and home-slot bits of a hash ---
+static ConcurrentMapShard_t* hash_shard(const ConcurrentMap_t* m, const uint64_t hash)
+{
+    return &m->shards[(size_t)(hash >> 40) & (m->shard_count - 1)];
+}
+
+static uint8_t hash_tag(const uint64_t hash)
+{
+    return (uint8_t)((hash >> 57) | 0x80);
+}
+
+static size_t hash_home(const ConcurrentMapTable_t* t, const uint64_t hash)
+{
+    return (size_t)hash & (t->capacity - 1);
+}
+
+// --- largest slot count a table may fill before it grows (3/4 load) ---
+static size_t max_load(const size_t capacity)
+{
+    return capacity - capacity / 4;
+}
+
+static unsigned char* slot_at(const ConcurrentMap_t* m, const ConcurrentMapTable_t* t, const size_t index)
+{
+    return t->slots + (index * m->slot_size);
+}
+
+// --- control bytes are the only table memory readers and writers touch atomically ---
+static uint8_t load_control(const ConcurrentMapTable_t* t, const size_t index)
+{
+    return __atomic_load_n(&t->control[index], __ATOMIC_RELAXED);
+}
+
+static void store_control(ConcurrentMapTable_t* t, const size_t index, const uint8_t tag)
+{
+    __atomic_store_n(&t->control[index], tag, __ATOMIC_RELAXED);
+}
+
+// --- seqlock: odd while a writer is inside, readers retry when it moved ---
+static void begin_write(ConcurrentMapShard_t* shard)
+{
+    const unsigned sequence = atomic_load_explicit(&shard->sequence, memory_order_relaxed);
+    atomic_store_explicit(&shard->sequence, sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+}
+
+static void end_write(ConcurrentMapShard_t* shard)
+{
+    const unsigned sequence = atomic_load_explicit(&shard->sequence, memory_order_relaxed);
+    atomic_store_explicit(&shard->sequence, sequence + 1, memory_order_release);
+}
+
+static bool read_is_valid(ConcurrentMapShard_t* shard, const unsigned begin)
+{
+    atomic_thread_fence(memory_order_acquire);
+    return atomic_load_explicit(&shard->sequence, memory_order_relaxed) == begin;
+}
+
+static ConcurrentMapTable_t* allocate_table(const ConcurrentMap_t* m, const size_t capacity)
+{
+    const size_t control_size = (capacity + 15) & ~(size_t)15;
+    if (capacity > (SIZE_MAX - TABLE_HEADER_SIZE - control_size) / m->slot_size) return NULL;
+
+    const size_t bytes          = TABLE_HEADER_SIZE + control_size + (capacity * m->slot_size);
+    ConcurrentMapTable_t* table = jester_allocate(m->allocator, bytes);
+    if (table == NULL) return NULL;
+
+    table->next_retired = NULL;
+    table->capacity     = capacity;
+    table->bytes        = bytes;
+    table->control      = (uint8_t*)table + TABLE_HEADER_SIZE;
+    table->slots        = table->control + control_size;
+    memset(table->control, CONTROL_EMPTY, capacity);
+    return table;
+}
+
+static void free_table_list(const ConcurrentMap_t* m, ConcurrentMapTable_t* table)
+{
+    while (table)
+    {
+        ConcurrentMapTable_t* next = table->next_retired;
+        jester_deallocate(m->allocator, table, table->bytes);
+        table = next;
+    }
+}
+
+// --- writer-side lookup, the shard lock must be held; returns the slot index or SIZE_MAX ---
+static size_t find_locked(const ConcurrentMap_t* m, const ConcurrentMapTable_t* t, const void* key,
+                          const uint64_t hash)
+{
+    if (t == NULL) return SIZE_MAX;
+
+    const size_t mask = t->capacity - 1;
+    const uint8_t tag = hash_tag(hash);
+    for (size_t i = hash_home(t, hash); t->control[i] != CONTROL_EMPTY; i = (i + 1) & mask)
+    {
+        if (t->control[i] == tag && m->equals(slot_at(m, t, i), key, m->key_size)) return i;
+    }
+    return SIZE_MAX;
+}
+
+// --- reader-side lookup against a table that may be changing underneath it ---
+static enum ProbeResult probe_snapshot(const ConcurrentMap_t* m, ConcurrentMapShard_t* shard, const unsigned begin,
+                                       const ConcurrentMapTable_t* t, const void* key, const uint64_t hash,
+                                       void* destination)
+{
+    const size_t mask = t->capacity - 1;
+    const uint8_t tag = hash_tag(hash);
+    size_t i          = hash_home(t, hash);
+
+    // --- bounded by the capacity: a torn view may not contain an empty slot ---
+    for (size_t step = 0; step < t->capacity; step++, i = (i + 1) & mask)
+    {
+        const uint8_t control = load_control(t, i);
+        if (control == CONTROL_EMPTY) return PROBE_MISS;
+        if (control != tag) continue;
+
+        const unsigned char* slot = slot_at(m, t, i);
+        if (m->equals == jester_hashmap_default_equals)
+        {
+            if (memcmp(slot, key, m->key_size) != 0) continue;
+        }
+        else
+        {
+            // --- a custom equality may follow pointers in the key, so only hand it a validated copy ---
+            unsigned char snapshot[JESTER_CONCURRENT_MAP_MAX_KEY_SIZE];
+            memcpy(snapshot, slot, m->key_size);
+            if (!read_is_valid(shard, begin)) return PROBE_TORN;
+            if (!m->equals(snapshot, key, m->key_size)) continue;
+        }
+
+        if (destination) memcpy(destination, slot + m->value_offset, m->value_size);
+        return PROBE_HIT;
+    }
+    return PROBE_MISS;
+}
+
+// --- make the shard's table fit count entries, publishing a new one if needed; the lock must be held ---
+static bool grow_shard(const ConcurrentMap_t* m, ConcurrentMapShard_t* shard, const size_t count)
+{
+    ConcurrentMapTable_t* old = atomic_load_explicit(&shard->table, memory_order_relaxed);
+
+    size_t capacity = old ? old->capacity : JESTER_CONCURRENT_MAP_MIN_CAPACITY;
+    while (max_load(capacity) < count)
+    {
+        if (capacity > SIZE_MAX / 2) return false;
+        capacity *= 2;
+    }
+    if (old && capacity == old->capacity) return true;
+
+    ConcurrentMapTable_t* fresh = allocate_table(m, capacity);
+    if (fresh == NULL) return false;
+
+    // --- rebuild privately, every key is already unique ---
+    for (size_t i = 0; old && i < old->capacity; i++)
+    {
+        if (old->control[i] == CONTROL_EMPTY) continue;
+
+        const unsigned char* slot = slot_at(m, old, i);
+        const uint64_t hash       = m->hash(slot, m->key_size);
+        size_t index              = hash_home(fresh, hash);
+        while (fresh->control[index] != CONTROL_EMPTY) index = (index + 1) & (capacity - 1);
+
+        memcpy(slot_at(m, fresh, index), slot, m->slot_size);
+        fresh->control[index] = old->control[i];
+    }
+
+    // --- publish; in-flight readers may still walk the old table, so retire it ---
+    atomic_store_explicit(&shard->table, fresh, memory_order_release);
+    if (old)
+    {
+        old->next_retired = shard->retired;
+        shard->retired    = old;
+    }
+    return true;
+}
+
+// --- insert or overwrite inside an open write window; returns true if a new entry was added ---
+static bool put_locked(const ConcurrentMap_t* m, ConcurrentMapTable_t* t, const void* key, const uint64_t hash,
+                       const void* value)
+{
+    size_t index     = find_locked(m, t, key, hash);
+    const bool added = index == SIZE_MAX;
+
+    if (added)
+    {
+        index = hash_home(t, hash);
+        while (t->control[index] != CONTROL_EMPTY) index = (index + 1) & (t->capacity - 1);
+        memcpy(slot_at(m, t, index), key, m->key_size);
+    }
+
+    unsigned char* destination = slot_at(m, t, index) + m->value_offset;
+    if (value) memcpy(destination, value, m->value_size);
+    else memset(destination, 0, m->value_size);
+
+    if (added) store_control(t, index, hash_tag(hash));
+    return added;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, failures leave shards = NULL               |
+//-----------------------------------------------------┙
+ConcurrentMap_t create_concurrent_map_custom(const size_t key_size, const size_t value_size, const size_t shard_count,
+                                             const JesterHashFn hash, const JesterEqualsFn equals,
+                                             const JesterAllocator_t* allocator)
+{
+    ConcurrentMap_t map = {};  // initialize to defaults
+    map.key_size        = key_size;
+    map.value_size      = value_size;
+    map.hash            = hash ? hash : jester_hashmap_default_hash;
+    map.equals          = equals ? equals : jester_hashmap_default_equals;
+    map.allocator       = allocator;
+
+    // --- a custom equality compares a stack snapshot of the key ---
+    if (map.equals != jester_hashmap_default_equals && key_size > JESTER_CONCURRENT_MAP_MAX_KEY_SIZE) return map;
+
+    // --- keys and values sit at their size's power-of-two factor (up to 16), slots pad to the larger ---
+    size_t key_align   = key_size ? (key_size & -key_size) : 1;
+    size_t value_align = value_size ? (value_size & -value_size) : 1;
+    if (key_align > 16) key_align = 16;
+    if (value_align > 16) value_align = 16;
+    const size_t align = key_align > value_align ? key_align : value_align;
+
+    map.value_offset = (key_size + value_align - 1) & ~(value_align - 1);
+    map.slot_size    = (map.value_offset + value_size + align - 1) & ~(align - 1);
+    if (map.slot_size == 0) map.slot_size = 1;
+
+    // --- power-of-two shard count ---
+    size_t shards = shard_count ? shard_count : JESTER_CONCURRENT_MAP_DEFAULT_SHARDS;
+    if (shards > JESTER_CONCURRENT_MAP_MAX_SHARDS) shards = JESTER_CONCURRENT_MAP_MAX_SHARDS;
+    map.shard_count = 1;
+    while (map.shard_count < shards) map.shard_count *= 2;
+
+    // --- one cache-line aligned shard per line, so writers on different shards never share one ---
+    const size_t shards_size = sizeof(ConcurrentMapShard_t) * map.shard_count + CACHE_LINE;
+    map.shards_block         = jester_allocate(allocator, shards_size);
+    if (map.shards_block == NULL) return map;
+
+    memset(map.shards_block, 0, shards_size);
+    const uintptr_t aligned = ((uintptr_t)map.shards_block + CACHE_LINE - 1) & ~(uintptr_t)(CACHE_LINE - 1);
+    map.shards              = (ConcurrentMapShard_t*)aligned;
+    for (size_t i = 0; i < map.shard_count; i++)
+    {
+        atomic_init(&map.shards[i].sequence, 0);
+        atomic_init(&map.shards[i].table, NULL);
+        atomic_init(&map.shards[i].count, 0);
+        pthread_mutex_init(&map.shards[i].lock, NULL);
+    }
+
+    return map;
+}
+
+ConcurrentMap_t create_concurrent_map(const size_t key_size, const size_t value_size)
+{
+    return create_concurrent_map_custom(key_size, value_size, 0, NULL, NULL, NULL);
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool insert_concurrent_map(ConcurrentMap_t* m, const void* key, const void* value)
+{
+    if (m->shards == NULL) return false;
+
+    const uint64_t hash         = m->hash(key, m->key_size);
+    ConcurrentMapShard_t* shard = hash_shard(m, hash);
+
+    pthread_mutex_lock(&shard->lock);
+    const size_t count = atomic_load_explicit(&shard->count, memory_order_relaxed);
+    if (!grow_shard(m, shard, count + 1))
+    {
+        pthread_mutex_unlock(&shard->lock);
+        return false;
+    }
+
+    ConcurrentMapTable_t* table = atomic_load_explicit(&shard->table, memory_order_relaxed);
+    begin_write(shard);
+    const bool added = put_locked(m, table, key, hash, value);
+    end_write(shard);
+
+    if (added) atomic_store_explicit(&shard->count, count + 1, memory_order_relaxed);
+    pthread_mutex_unlock(&shard->lock);
+    return true;
+}
+
+bool insert_concurrent_map_bulk(ConcurrentMap_t* m, const void* keys, const void* values, const size_t count)
+{
+    if (m->shards == NULL) return false;
+    if (count == 0) return true;
+    if (count > (SIZE_MAX / 2) / (sizeof(uint64_t) + sizeof(size_t))) return false;
+
+    // --- scratch: per-pair hashes, pair order grouped by shard, and shard bucket ends ---
+    const size_t scratch_size = count * (sizeof(uint64_t) + sizeof(size_t)) + m->shard_count * sizeof(size_t);
+    uint64_t* hashes          = jester_allocate(m->allocator, scratch_size);
+    if (hashes == NULL) return false;
+
+    size_t* order = (size_t*)(hashes + count);
+    size_t* ends  = order + count;
+    memset(ends, 0, m->shard_count * sizeof(size_t));
+
+    // --- counting sort by shard ---
+    const unsigned char* key_bytes = keys;
+    for (size_t i = 0; i < count; i++)
+    {
+        hashes[i] = m->hash(key_bytes + (i * m->key_size), m->key_size);
+        ends[hash_shard(m, hashes[i]) - m->shards]++;
+    }
+    for (size_t s = 1; s < m->shard_count; s++) ends[s] += ends[s - 1];
+
+    // --- placing back to front leaves ends[s] at the start of bucket s ---
+    for (size_t i = count; i-- > 0;) order[--ends[hash_shard(m, hashes[i]) - m->shards]] = i;
+
+    bool ok = true;
+    for (size_t s = 0; s < m->shard_count && ok; s++)
+    {
+        const size_t start = ends[s];
+        const size_t end   = s + 1 < m->shard_count ? ends[s + 1] : count;
+        if (start == end) continue;
+
+        // --- one lock, one growth, and one write window per shard ---
+        ConcurrentMapShard_t* shard = &m->shards[s];
+        pthread_mutex_lock(&shard->lock);
+
+        size_t shard_count = atomic_load_explicit(&shard->count, memory_order_relaxed);
+        ok                 = grow_shard(m, shard, shard_count + (end - start));
+        if (ok)
+        {
+            ConcurrentMapTable_t* table = atomic_load_explicit(&shard->table, memory_order_relaxed);
+            begin_write(shard);
+            for (size_t k = start; k < end; k++)
+            {
+                const size_t i    = order[k];
+                const void* value = values ? (const unsigned char*)values + (i * m->value_size) : NULL;
+                shard_count += put_locked(m, table, key_bytes + (i * m->key_size), hashes[i], value);
+            }
+            end_write(shard);
+            atomic_store_explicit(&shard->count, shard_count, memory_order_relaxed);
+        }
+
+        pthread_mutex_unlock(&shard->lock);
+    }
+
+    jester_deallocate(m->allocator, hashes, scratch_size);
+    return ok;
+}
+
+bool get_concurrent_map(const ConcurrentMap_t* m, const void* key, void* destination)
+{
+    if (m->shards == NULL) return false;
+
+    const uint64_t hash         = m->hash(key, m->key_size);
+    ConcurrentMapShard_t* shard = hash_shard(m, hash);
+
+    for (;;)
+    {
+        const unsigned begin = atomic_load_explicit(&shard->sequence, memory_order_acquire);
+        if (begin & 1)
+        {
+            cpu_relax();  // a writer is inside
+            continue;
+        }
+
+        const ConcurrentMapTable_t* table = atomic_load_explicit(&shard->table, memory_order_acquire);
+        const enum ProbeResult result =
+            table ? probe_snapshot(m, shard, begin, table, key, hash, destination) : PROBE_MISS;
+
+        if (result != PROBE_TORN && read_is_valid(shard, begin)) return result == PROBE_HIT;
+    }
+}
+
+bool contains_concurrent_map(const ConcurrentMap_t* m, const void* key)
+{
+    return get_concurrent_map(m, key, NULL);
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool remove_concurrent_map(ConcurrentMap_t* m, const void* key, void* destination)
+{
+    if (m->shards == NULL) return false;
+
+    const uint64_t hash         = m->hash(key, m->key_size);
+    ConcurrentMapShard_t* shard = hash_shard(m, hash);
+    pthread_mutex_lock(&shard->lock);
+
+    ConcurrentMapTable_t* t = atomic_load_explicit(&shard->table, memory_order_relaxed);
+    size_t hole             = find_locked(m, t, key, hash);
+    if (hole == SIZE_MAX)
+    {
+        pthread_mutex_unlock(&shard->lock);
+        return false;  // key not present
+    }
+
+    if (destination) memcpy(destination, slot_at(m, t, hole) + m->value_offset, m->value_size);
+
+    // --- backward shift: pull later entries of the run into the hole while that stays on their probe path ---
+    begin_write(shard);
+    const size_t mask = t->capacity - 1;
+    for (size_t next = (hole + 1) & mask; t->control[next] != CONTROL_EMPTY; next = (next + 1) & mask)
+    {
+        const size_t home = hash_home(t, m->hash(slot_at(m, t, next), m->key_size));
+        if (((next - home) & mask) < ((next - hole) & mask)) continue;  // hole lies before its home slot
+
+        memcpy(slot_at(m, t, hole), slot_at(m, t, next), m->slot_size);
+        store_control(t, hole, t->control[next]);
+        hole = next;
+    }
+    store_control(t, hole, CONTROL_EMPTY);
+    end_write(shard);
+
+    atomic_store_explicit(&shard->count, atomic_load_explicit(&shard->count, memory_order_relaxed) - 1,
+                          memory_order_relaxed);
+    pthread_mutex_unlock(&shard->lock);
+    return true;
+}
+
+size_t get_concurrent_map_count(const ConcurrentMap_t* m)
+{
+    size_t count = 0;
+    for (size_t i = 0; m->shards && i < m->shard_count; i++)
+    {
+        count += atomic_load_explicit(&m->shards[i].count, memory_order_relaxed);
+    }
+    return count;
+}
+
+bool reclaim_concurrent_map(ConcurrentMap_t* m)
+{
+    bool freed = false;
+    for (size_t i = 0; m->shards && i < m->shard_count; i++)
+    {
+        ConcurrentMapShard_t* shard = &m->shards[i];
+        pthread_mutex_lock(&shard->lock);
+        freed |= shard->retired != NULL;
+        free_table_list(m, shard->retired);
+        shard->retired = NULL;
+        pthread_mutex_unlock(&shard->lock);
+    }
+    return freed;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool free_concurrent_map(ConcurrentMap_t* m)
+{
+    // --- nothing allocated yet ---
+    if (m->shards_block == NULL) return false;
+
+    for (size_t i = 0; i < m->shard_count; i++)
+    {
+        ConcurrentMapShard_t* shard = &m->shards[i];
+        free_table_list(m, atomic_load_explicit(&shard->table, memory_order_relaxed));
+        free_table_list(m, shard->retired);
+        pthread_mutex_destroy(&shard->lock);
+    }
+
+    const size_t shards_size = sizeof(ConcurrentMapShard_t) * m->shard_count + CACHE_LINE;
+    jester_deallocate(m->allocator, m->shards_block, shards_size);
+    m->shards_block = NULL;
+    m->shards       = NULL;
+    return true;
+}
@@ -0,0 +1,371 @@
+﻿/**
+ * @file      jester-hashmap.c
+ * @brief     Implementation of the SIMD-probed open-addressing hash map for the Jester stdlib.
+ *
+ * @details   The 64-bit hash is split in two: the low 7 bits (h2) become the
+ *            slot's control tag, the rest (h1) picks the home slot. Control
+ *            bytes are EMPTY (0x80) or a tag in 0..127, so a single movemask
+ *            over a group yields its empty slots. The probe run of a key is
+ *            the contiguous stretch of slots from its home slot, scanned one
+ *            16-byte group at a time; with no tombstones, reaching a group
+ *            that contains an EMPTY slot ends the search.
+ *
+ *            The table is one allocation: capacity + 16 control bytes
+ *            (the last 16 mirror the first 16), padded to 16 bytes, then the
+ *            slots.
+ *
+ * @copyright GPL-3.0
+ * @author    Case Presley
+ * @date      10-17-2026
+ */
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include "jester/datastructs/map/jester-hashmap.h"         // |
+#include "jester/hash/jester-hash.h"                       // |
+#include <string.h>                                        // |
+#ifdef __SSE2__                                            // |
+#include <emmintrin.h>                                     // |
+#endif                                                     // |
+//------------------------------------------------------------┙
+
+#define CONTROL_EMPTY ((uint8_t)0x80)
+
+// --- control tag and home-slot bits of a hash ---
+static uint8_t hash_tag(const uint64_t hash)
+{
+    return (uint8_t)(hash & 0x7F);
+}
+
+static size_t hash_home(const HashMap_t* m, const uint64_t hash)
+{
+    return (size_t)(hash >> 7) & (m->capacity - 1);
+}
+
+// --- largest slot count the table may fill before it grows (7/8 load) ---
+static size_t max_load(const size_t capacity)
+{
+    return capacity - capacity / 8;
+}
+
+// --- bitmask of the group's slots whose tag equals the given one ---
+static uint32_t match_tag(const uint8_t* group, const uint8_t tag)
+{
+#ifdef __SSE2__
+    const __m128i control = _mm_loadu_si128((const __m128i*)group);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8((char)tag)));
+#else
+    uint32_t mask = 0;
+    for (uint32_t i = 0; i < JESTER_HASHMAP_GROUP_WIDTH; i++) mask |= (uint32_t)(group[i] == tag) << i;
+    return mask;
+#endif
+}
+
+// --- bitmask of the group's empty slots (the only tags with the high bit set) ---
+static uint32_t match_empty(const uint8_t* group)
+{
+#ifdef __SSE2__
+    return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+#else
+    uint32_t mask = 0;
+    for (uint32_t i = 0; i < JESTER_HASHMAP_GROUP_WIDTH; i++) mask |= (uint32_t)(group[i] >> 7) << i;
+    return mask;
+#endif
+}
+
+static unsigned char* slot_at(const HashMap_t* m, const size_t index)
+{
+    return m->slots + (index * m->slot_size);
+}
+
+// --- write a control byte, keeping the mirrored copy of the first group in sync ---
+static void set_control(HashMap_t* m, const size_t index, const uint8_t tag)
+{
+    m->control[index] = tag;
+    if (index < JESTER_HASHMAP_GROUP_WIDTH) m->control[m->capacity + index] = tag;
+}
+
+// --- control bytes padded so the slots that follow stay 16-byte aligned ---
+static size_t control_bytes(const size_t capacity)
+{
+    return (capacity + JESTER_HASHMAP_GROUP_WIDTH + 15) & ~(size_t)15;
+}
+
+// --- key comparison with the default equality inlined for word-sized keys ---
+static bool keys_equal(const HashMap_t* m, const void* a, const void* b)
+{
+    if (m->equals != jester_hashmap_default_equals) return m->equals(a, b, m->key_size);
+
+    switch (m->key_size)
+    {
+        case 4:
+        {
+            uint32_t x, y;
+            memcpy(&x, a, 4);
+            memcpy(&y, b, 4);
+            return x == y;
+        }
+        case 8:
+        {
+            uint64_t x, y;
+            memcpy(&x, a, 8);
+            memcpy(&y, b, 8);
+            return x == y;
+        }
+        default:
+            return memcmp(a, b, m->key_size) == 0;
+    }
+}
+
+// --- slot holding key, or SIZE_MAX ---
+static size_t find_slot(const HashMap_t* m, const void* key, const uint64_t hash)
+{
+    if (m->capacity == 0) return SIZE_MAX;
+
+    const size_t mask = m->capacity - 1;
+    const uint8_t tag = hash_tag(hash);
+    size_t position   = hash_home(m, hash);
+
+    for (;;)
+    {
+        const uint8_t* group = m->control + position;
+
+        // --- only slots whose tag matches have their key compared ---
+        for (uint32_t matches = match_tag(group, tag); matches; matches &= matches - 1)
+        {
+            const size_t index = (position + (size_t)__builtin_ctz(matches)) & mask;
+            if (keys_equal(m, slot_at(m, index), key)) return index;
+        }
+
+        // --- an empty slot ends the probe run ---
+        if (match_empty(group)) return SIZE_MAX;
+        position = (position + JESTER_HASHMAP_GROUP_WIDTH) & mask;
+    }
+}
+
+// --- first empty slot in the probe run starting at the hash's home slot ---
+static size_t find_empty_slot(const HashMap_t* m, const uint64_t hash)
+{
+    const size_t mask = m->capacity - 1;
+    size_t position   = hash_home(m, hash);
+
+    for (;;)
+    {
+        const uint32_t empties = match_empty(m->control + position);
+        if (empties) return (position + (size_t)__builtin_ctz(empties)) & mask;
+        position = (position + JESTER_HASHMAP_GROUP_WIDTH) & mask;
+    }
+}
+
+// --- move every entry into a new table of the given power-of-two capacity ---
+static bool rehash_hashmap(HashMap_t* m, const size_t new_capacity)
+{
+    if (new_capacity > (SIZE_MAX - control_bytes(0)) / (m->slot_size + 1)) return false;
+
+    const size_t new_control_bytes = control_bytes(new_capacity);
+    unsigned char* block = jester_allocate(m->allocator, new_control_bytes + (new_capacity * m->slot_size));
+    if (block == NULL) return false;
+
+    HashMap_t fresh = *m;
+    fresh.control   = block;
+    fresh.slots     = block + new_control_bytes;
+    fresh.capacity  = new_capacity;
+    memset(fresh.control, CONTROL_EMPTY, new_capacity + JESTER_HASHMAP_GROUP_WIDTH);
+
+    // --- reinsert without equality checks, every key is already unique ---
+    for (size_t i = 0; i < m->capacity; i++)
+    {
+        if (m->control[i] == CONTROL_EMPTY) continue;
+
+        const unsigned char* slot = slot_at(m, i);
+        const uint64_t hash       = m->hash(slot, m->key_size);
+        const size_t index        = find_empty_slot(&fresh, hash);
+        memcpy(slot_at(&fresh, index), slot, m->slot_size);
+        set_control(&fresh, index, hash_tag(hash));
+    }
+
+    if (m->control)
+    {
+        jester_deallocate(m->allocator, m->control, control_bytes(m->capacity) + (m->capacity * m->slot_size));
+    }
+
+    *m = fresh;
+    return true;
+}
+
+uint64_t jester_hashmap_default_hash(const void* key, const size_t key_size)
+{
+    return jester_hash(key, key_size, 0);
+}
+
+bool jester_hashmap_default_equals(const void* a, const void* b, const size_t key_size)
+{
+    return memcmp(a, b, key_size) == 0;
+}
+
+HashMap_t create_hashmap_custom(const size_t key_size, const size_t value_size, const JesterHashFn hash,
+                                const JesterEqualsFn equals, const JesterAllocator_t* allocator)
+{
+    HashMap_t hashmap  = {};  // initialize to defaults
+    hashmap.key_size   = key_size;
+    hashmap.value_size = value_size;
+    hashmap.hash       = hash ? hash : jester_hashmap_default_hash;
+    hashmap.equals     = equals ? equals : jester_hashmap_default_equals;
+    hashmap.allocator  = allocator;
+
+    // --- keys and values sit at their size's power-of-two factor (up to 16), slots pad to the larger ---
+    size_t key_align   = key_size ? (key_size & -key_size) : 1;
+    size_t value_align = value_size ? (value_size & -value_size) : 1;
+    if (key_align > 16) key_align = 16;
+    if (value_align > 16) value_align = 16;
+    const size_t align = key_align > value_align ? key_align : value_align;
+
+    hashmap.value_offset = (key_size + value_align - 1) & ~(value_align - 1);
+    hashmap.slot_size    = (hashmap.value_offset + value_size + align - 1) & ~(align - 1);
+    if (hashmap.slot_size == 0) hashmap.slot_size = 1;
+
+    return hashmap;
+}
+
+HashMap_t create_hashmap(const size_t key_size, const size_t value_size)
+{
+    return create_hashmap_custom(key_size, value_size, NULL, NULL, NULL);
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool reserve_hashmap(HashMap_t* m, const size_t count)
+{
+    // --- smallest power-of-two capacity whose 7/8 load fits count ---
+    size_t capacity = m->capacity ? m->capacity : JESTER_HASHMAP_MIN_CAPACITY;
+    while (max_load(capacity) < count)
+    {
+        if (capacity > SIZE_MAX / 2) return false;
+        capacity *= 2;
+    }
+
+    return capacity == m->capacity || rehash_hashmap(m, capacity);
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return NULL on failure                     |
+//-----------------------------------------------------┙
+void* get_or_insert_hashmap(HashMap_t* m, const void* key, bool* inserted)
+{
+    const uint64_t hash = m->hash(key, m->key_size);
+
+    // --- existing key ---
+    const size_t found = find_slot(m, key, hash);
+    if (found != SIZE_MAX)
+    {
+        if (inserted) *inserted = false;
+        return slot_at(m, found) + m->value_offset;
+    }
+
+    // --- grow before the insert would pass the load factor ---
+    if (m->count + 1 > max_load(m->capacity) && !reserve_hashmap(m, m->count + 1)) return NULL;
+
+    // --- claim the first empty slot of the probe run ---
+    const size_t index  = find_empty_slot(m, hash);
+    unsigned char* slot = slot_at(m, index);
+    memcpy(slot, key, m->key_size);
+    memset(slot + m->value_offset, 0, m->value_size);
+    set_control(m, index, hash_tag(hash));
+    m->count++;
+
+    if (inserted) *inserted = true;
+    return slot + m->value_offset;
+}
+
+bool insert_hashmap(HashMap_t* m, const void* key, const void* value)
+{
+    void* destination = get_or_insert_hashmap(m, key, NULL);
+    if (destination == NULL) return false;
+
+    if (value) memcpy(destination, value, m->value_size);
+    else memset(destination, 0, m->value_size);
+    return true;
+}
+
+void* get_hashmap_value(const HashMap_t* m, const void* key)
+{
+    const size_t index = find_slot(m, key, m->hash(key, m->key_size));
+    return index != SIZE_MAX ? slot_at(m, index) + m->value_offset : NULL;
+}
+
+bool contains_hashmap(const HashMap_t* m, const void* key)
+{
+    return find_slot(m, key, m->hash(key, m->key_size)) != SIZE_MAX;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool remove_hashmap(HashMap_t* m, const void* key, void* destination)
+{
+    size_t hole = find_slot(m, key, m->hash(key, m->key_size));
+    if (hole == SIZE_MAX) return false;  // key not present
+
+    if (destination) memcpy(destination, slot_at(m, hole) + m->value_offset, m->value_size);
+
+    // --- backward shift: pull later entries of the run into the hole while that stays on their probe path ---
+    const size_t mask = m->capacity - 1;
+    for (size_t next = (hole + 1) & mask; m->control[next] != CONTROL_EMPTY; next = (next + 1) & mask)
+    {
+        const size_t home = hash_home(m, m->hash(slot_at(m, next), m->key_size));
+        if (((next - home) & mask) < ((next - hole) & mask)) continue;  // hole lies before its home slot
+
+        memcpy(slot_at(m, hole), slot_at(m, next), m->slot_size);
+        set_control(m, hole, m->control[next]);
+        hole = next;
+    }
+
+    set_control(m, hole, CONTROL_EMPTY);
+    m->count--;
+    return true;
+}
+
+bool next_hashmap(const HashMap_t* m, size_t* iterator, void** key, void** value)
+{
+    for (size_t i = *iterator; i < m->capacity; i++)
+    {
+        if (m->control[i] == CONTROL_EMPTY) continue;
+
+        unsigned char* slot = slot_at(m, i);
+        if (key) *key = slot;
+        if (value) *value = slot + m->value_offset;
+        *iterator = i + 1;
+        return true;
+    }
+
+    *iterator = m->capacity;
+    return false;
+}
+
+bool clear_hashmap(HashMap_t* m)
+{
+    // --- mark every slot empty (reuse existing table) ---
+    if (m->control) memset(m->control, CONTROL_EMPTY, m->capacity + JESTER_HASHMAP_GROUP_WIDTH);
+    m->count = 0;
+    return true;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool free_hashmap(HashMap_t* m)
+{
+    // --- nothing allocated yet ---
+    if (m->control == NULL) return false;
+
+    jester_deallocate(m->allocator, m->control, control_bytes(m->capacity) + (m->capacity * m->slot_size));
+    m->control  = NULL;
+    m->slots    = NULL;
+    m->count    = 0;
+    m->capacity = 0;
+    return true;
+}
@@ -0,0 +1,65 @@
+﻿/**
+ * @file      jester-hashset.c
+ * @brief     Implementation of the hash set for the Jester stdlib.
+ *
+ * @details   Thin layer over HashMap_t with a value size of 0.
+ *
+ * @copyright GPL-3.0
+ * @author    Case Presley
+ * @date      10-17-2026
+ */
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include "jester/datastructs/map/jester-hashset.h"         // |
+//------------------------------------------------------------┙
+
+HashSet_t create_hashset_custom(const size_t key_size, const JesterHashFn hash, const JesterEqualsFn equals,
+                                const JesterAllocator_t* allocator)
+{
+    const HashSet_t hashset = {create_hashmap_custom(key_size, 0, hash, equals, allocator)};
+    return hashset;
+}
+
+HashSet_t create_hashset(const size_t key_size)
+{
+    return create_hashset_custom(key_size, NULL, NULL, NULL);
+}
+
+bool reserve_hashset(HashSet_t* s, const size_t count)
+{
+    return reserve_hashmap(&s->map, count);
+}
+
+bool insert_hashset(HashSet_t* s, const void* key, bool* added)
+{
+    return get_or_insert_hashmap(&s->map, key, added) != NULL;
+}
+
+bool contains_hashset(const HashSet_t* s, const void* key)
+{
+    return contains_hashmap(&s->map, key);
+}
+
+bool remove_hashset(HashSet_t* s, const void* key)
+{
+    return remove_hashmap(&s->map, key, NULL);
+}
+
+bool next_hashset(const HashSet_t* s, size_t* iterator, const void** key)
+{
+    void* slot = NULL;
+    if (!next_hashmap(&s->map, iterator, &slot, NULL)) return false;
+
+    if (key) *key = slot;
+    return true;
+}
+
+bool clear_hashset(HashSet_t* s)
+{
+    return clear_hashmap(&s->map);
+}
+
+bool free_hashset(HashSet_t* s)
+{
+    return free_hashmap(&s->map);
+}
@@ -0,0 +1,182 @@
+﻿/**
+ * @file      jester-slot-map.c
+ * @brief     Implementation of the generational-handle slot map for the Jester stdlib.
+ *
+ * @details   Three DynamicArray_t columns: the dense values, the slot index
+ *            owning each value, and the slot table. A handle resolves through
+ *            its slot to a dense index; removal swap-removes from both dense
+ *            columns and repoints the slot of the value that was moved.
+ *
+ * @copyright GPL-3.0
+ * @author    Case Presley
+ * @date      10-17-2026
+ */
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include "jester/datastructs/map/jester-slot-map.h"        // |
+#include <string.h>                                        // |
+//------------------------------------------------------------┙
+
+typedef struct SlotMapSlot
+{
+    uint32_t generation;  // odd while occupied
+    uint32_t link;        // dense index while occupied, next free slot while free
+} SlotMapSlot_t;
+
+#define NO_FREE_SLOT UINT32_MAX
+
+static SlotMapHandle_t make_handle(const uint32_t generation, const uint32_t index)
+{
+    return ((SlotMapHandle_t)generation << 32) | index;
+}
+
+// --- slot a handle refers to, or NULL if the handle is stale or invalid ---
+static SlotMapSlot_t* resolve_handle(const SlotMap_t* m, const SlotMapHandle_t handle)
+{
+    const uint32_t index      = (uint32_t)handle;
+    const uint32_t generation = (uint32_t)(handle >> 32);
+    if ((generation & 1) == 0 || index >= m->slots.count) return NULL;
+
+    SlotMapSlot_t* slot = (SlotMapSlot_t*)m->slots.data + index;
+    return slot->generation == generation ? slot : NULL;
+}
+
+SlotMap_t create_slot_map_with_allocator(const size_t value_size, const JesterAllocator_t* allocator)
+{
+    SlotMap_t slot_map   = {};  // initialize to defaults
+    slot_map.values      = create_dynamic_array_with_allocator(value_size, 0, allocator);
+    slot_map.dense_slots = create_dynamic_array_with_allocator(sizeof(uint32_t), 0, allocator);
+    slot_map.slots       = create_dynamic_array_with_allocator(sizeof(SlotMapSlot_t), 0, allocator);
+    slot_map.free_head   = NO_FREE_SLOT;
+    return slot_map;
+}
+
+SlotMap_t create_slot_map(const size_t value_size)
+{
+    return create_slot_map_with_allocator(value_size, NULL);
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return the invalid handle on failure       |
+//-----------------------------------------------------┙
+SlotMapHandle_t insert_slot_map(SlotMap_t* m, const void* value)
+{
+    // --- dense indices and slot indices must fit in 32 bits ---
+    if (m->values.count >= NO_FREE_SLOT) return JESTER_SLOT_MAP_INVALID_HANDLE;
+    const uint32_t dense_index = (uint32_t)m->values.count;
+
+    // --- take a free slot, or append a fresh one ---
+    uint32_t index = m->free_head;
+    if (index == NO_FREE_SLOT)
+    {
+        if (m->slots.count >= NO_FREE_SLOT) return JESTER_SLOT_MAP_INVALID_HANDLE;
+
+        const SlotMapSlot_t fresh = {0, NO_FREE_SLOT};
+        if (!push_dynamic_array(&m->slots, &fresh)) return JESTER_SLOT_MAP_INVALID_HANDLE;
+        index = (uint32_t)(m->slots.count - 1);
+    }
+
+    // --- store the value densely, undoing a freshly appended slot on failure ---
+    if (!push_dynamic_array(&m->values, value) || !push_dynamic_array(&m->dense_slots, &index))
+    {
+        m->values.count = dense_index;
+        if (index != m->free_head) m->slots.count--;  // a reused slot is still on the free list
+        return JESTER_SLOT_MAP_INVALID_HANDLE;
+    }
+
+    // --- occupy the slot (generation becomes odd) ---
+    SlotMapSlot_t* slot = (SlotMapSlot_t*)m->slots.data + index;
+    if (index == m->free_head) m->free_head = slot->link;
+    slot->generation++;
+    slot->link = dense_index;
+
+    return make_handle(slot->generation, index);
+}
+
+void* get_slot_map_element(const SlotMap_t* m, const SlotMapHandle_t handle)
+{
+    const SlotMapSlot_t* slot = resolve_handle(m, handle);
+    return slot ? (char*)m->values.data + ((size_t)slot->link * m->values.element_size) : NULL;
+}
+
+bool contains_slot_map(const SlotMap_t* m, const SlotMapHandle_t handle)
+{
+    return resolve_handle(m, handle) != NULL;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool remove_slot_map(SlotMap_t* m, const SlotMapHandle_t handle, void* destination)
+{
+    SlotMapSlot_t* slot = resolve_handle(m, handle);
+    if (slot == NULL) return false;  // stale or invalid handle
+
+    const uint32_t dense_index = slot->link;
+    if (destination)
+    {
+        const char* value = (char*)m->values.data + ((size_t)dense_index * m->values.element_size);
+        memcpy(destination, value, m->values.element_size);
+    }
+
+    // --- keep storage dense: the last value moves into the hole ---
+    swap_remove_dynamic_array(&m->values, dense_index);
+    swap_remove_dynamic_array(&m->dense_slots, dense_index);
+    if (dense_index < m->dense_slots.count)
+    {
+        const uint32_t moved_slot                        = ((uint32_t*)m->dense_slots.data)[dense_index];
+        ((SlotMapSlot_t*)m->slots.data)[moved_slot].link = dense_index;
+    }
+
+    // --- free the slot (generation becomes even, stale handles stop resolving) ---
+    slot->generation++;
+    slot->link   = m->free_head;
+    m->free_head = (uint32_t)(slot - (SlotMapSlot_t*)m->slots.data);
+
+    return true;
+}
+
+SlotMapHandle_t get_slot_map_handle(const SlotMap_t* m, const size_t dense_index)
+{
+    if (dense_index >= m->dense_slots.count) return JESTER_SLOT_MAP_INVALID_HANDLE;
+
+    const uint32_t index = ((uint32_t*)m->dense_slots.data)[dense_index];
+    return make_handle(((SlotMapSlot_t*)m->slots.data)[index].generation, index);
+}
+
+bool clear_slot_map(SlotMap_t* m)
+{
+    // --- free every occupied slot ---
+    for (size_t i = 0; i < m->dense_slots.count; i++)
+    {
+        const uint32_t index = ((uint32_t*)m->dense_slots.data)[i];
+        SlotMapSlot_t* slot  = (SlotMapSlot_t*)m->slots.data + index;
+        slot->generation++;
+        slot->link   = m->free_head;
+        m->free_head = index;
+    }
+
+    clear_dynamic_array(&m->values);
+    clear_dynamic_array(&m->dense_slots);
+    return true;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool free_slot_map(SlotMap_t* m)
+{
+    const size_t value_size            = m->values.element_size;
+    const JesterAllocator_t* allocator = m->values.allocator;
+
+    bool freed = free_dynamic_array(&m->values);
+    freed      = free_dynamic_array(&m->dense_slots) || freed;
+    freed      = free_dynamic_array(&m->slots) || freed;
+
+    // --- leave an empty map that can be reused ---
+    *m = create_slot_map_with_allocator(value_size, allocator);
+    return freed;
+}
@@ -0,0 +1,263 @@
+﻿/**
+ * @file      jester-deque.c
+ * @brief     Implementation of the ring buffer / double-ended queue for the Jester stdlib.
+ *
+ * @details   Slots are addressed as (head + i) & (capacity - 1). The elements
+ *            occupy at most two runs of the ring: from head to the end of the
+ *            storage, and the wrapped remainder from slot 0. Every bulk copy is
+ *            split along that boundary.
+ *
+ * @copyright GPL-3.0
+ * @author    Case Presley
+ * @date      10-17-2026
+ */
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include "jester/datastructs/queue/jester-deque.h"         // |
+#include <stdint.h>                                        // |
+#include <string.h>                                        // |
+//------------------------------------------------------------┙
+
+// --- smallest power of two >= n, or 0 on overflow ---
+static size_t round_up_pow2(const size_t n)
+{
+    if (n <= 1) return 1;
+    if (n > (SIZE_MAX >> 1) + 1) return 0;
+    return (size_t)1 << (64 - __builtin_clzll((unsigned long long)(n - 1)));
+}
+
+static char* slot_address(const Deque_t* d, const size_t position)
+{
+    return (char*)d->data + ((position & (d->capacity - 1)) * d->element_size);
+}
+
+// --- copy n elements out of the ring starting at a logical position, in at most two runs ---
+static void copy_out(const Deque_t* d, const size_t position, void* destination, const size_t n)
+{
+    const size_t start = position & (d->capacity - 1);
+    const size_t first = n < d->capacity - start ? n : d->capacity - start;
+
+    memcpy(destination, slot_address(d, start), first * d->element_size);
+    memcpy((char*)destination + (first * d->element_size), d->data, (n - first) * d->element_size);
+}
+
+// --- copy n elements into the ring starting at a logical position, in at most two runs ---
+static void copy_in(Deque_t* d, const size_t position, const void* source, const size_t n)
+{
+    const size_t start = position & (d->capacity - 1);
+    const size_t first = n < d->capacity - start ? n : d->capacity - start;
+
+    memcpy(slot_address(d, start), source, first * d->element_size);
+    memcpy(d->data, (const char*)source + (first * d->element_size), (n - first) * d->element_size);
+}
+
+// --- make room for min_count elements, doubling when that is larger ---
+static bool grow_deque(Deque_t* d, const size_t min_count)
+{
+    if (d->capacity >= min_count) return true;
+
+    const size_t doubled = d->capacity ? d->capacity * 2 : JESTER_DEQUE_MIN_CAPACITY;
+    return reserve_deque(d, doubled > min_count ? doubled : min_count);
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+Deque_t create_deque_with_allocator(const size_t element_size, const size_t capacity,
+                                    const JesterAllocator_t* allocator)
+{
+    Deque_t deque      = {};  // initialize to defaults
+    deque.element_size = element_size;
+    deque.allocator    = allocator;
+
+    if (capacity != 0) reserve_deque(&deque, capacity);
+    return deque;
+}
+
+Deque_t create_deque(const size_t element_size, const size_t capacity)
+{
+    return create_deque_with_allocator(element_size, capacity, NULL);
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool reserve_deque(Deque_t* d, const size_t new_capacity)
+{
+    // --- check if the current capacity is sufficient ---
+    if (d->capacity >= new_capacity) return true;
+
+    const size_t capacity = round_up_pow2(new_capacity);
+    if (capacity == 0 || (d->element_size != 0 && capacity > SIZE_MAX / d->element_size)) return false;
+
+    void* data = jester_allocate(d->allocator, capacity * d->element_size);
+    if (data == NULL) return false;
+
+    // --- relinearize: both runs land in order at the start of the new ring ---
+    if (d->count != 0) copy_out(d, d->head, data, d->count);
+    if (d->data) jester_deallocate(d->allocator, d->data, d->capacity * d->element_size);
+
+    d->data     = data;
+    d->head     = 0;
+    d->capacity = capacity;
+    return true;
+}
+
+bool push_back_deque(Deque_t* d, const void* data)
+{
+    if (d->count == d->capacity && !grow_deque(d, d->count + 1)) return false;
+
+    memcpy(slot_address(d, d->head + d->count), data, d->element_size);
+    d->count++;
+    return true;
+}
+
+bool push_front_deque(Deque_t* d, const void* data)
+{
+    if (d->count == d->capacity && !grow_deque(d, d->count + 1)) return false;
+
+    d->head = (d->head - 1) & (d->capacity - 1);
+    memcpy(slot_address(d, d->head), data, d->element_size);
+    d->count++;
+    return true;
+}
+
+bool pop_front_deque(Deque_t* d, void* destination)
+{
+    // --- ensure deque is not empty ---
+    if (d->count == 0) return false;
+
+    if (destination) memcpy(destination, slot_address(d, d->head), d->element_size);
+    d->head = (d->head + 1) & (d->capacity - 1);
+    d->count--;
+    return true;
+}
+
+bool pop_back_deque(Deque_t* d, void* destination)
+{
+    // --- ensure deque is not empty ---
+    if (d->count == 0) return false;
+
+    d->count--;
+    if (destination) memcpy(destination, slot_address(d, d->head + d->count), d->element_size);
+    return true;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return NULL when index is out of bounds    |
+//-----------------------------------------------------┙
+void* get_deque_element(const Deque_t* d, const size_t index)
+{
+    return index < d->count ? slot_address(d, d->head + index) : NULL;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool push_back_deque_bulk(Deque_t* d, const void* source, const size_t n)
+{
+    if (n == 0) return true;
+    if (n > SIZE_MAX - d->count || !grow_deque(d, d->count + n)) return false;
+
+    copy_in(d, d->head + d->count, source, n);
+    d->count += n;
+    return true;
+}
+
+bool push_front_deque_bulk(Deque_t* d, const void* source, const size_t n)
+{
+    if (n == 0) return true;
+    if (n > SIZE_MAX - d->count || !grow_deque(d, d->count + n)) return false;
+
+    // --- positions wrap modulo the power-of-two capacity, so head - n needs no special case ---
+    d->head = (d->head - n) & (d->capacity - 1);
+    copy_in(d, d->head, source, n);
+    d->count += n;
+    return true;
+}
+
+size_t pop_front_deque_bulk(Deque_t* d, void* destination, const size_t n)
+{
+    const size_t taken = n < d->count ? n : d->count;
+    if (taken == 0) return 0;
+
+    if (destination) copy_out(d, d->head, destination, taken);
+    d->head   = (d->head + taken) & (d->capacity - 1);
+    d->count -= taken;
+    return taken;
+}
+
+size_t pop_back_deque_bulk(Deque_t* d, void* destination, const size_t n)
+{
+    const size_t taken = n < d->count ? n : d->count;
+    if (taken == 0) return 0;
+
+    if (destination) copy_out(d, d->head + d->count - taken, destination, taken);
+    d->count -= taken;
+    return taken;
+}
+
+void* get_deque_front_span(const Deque_t* d, size_t* count)
+{
+    // --- the front run stops at the end of the storage ---
+    const size_t to_end = d->capacity - d->head;
+    *count              = d->count < to_end ? d->count : to_end;
+    return d->count ? slot_address(d, d->head) : NULL;
+}
+
+bool consume_deque_front(Deque_t* d, const size_t n)
+{
+    if (n > d->count) return false;
+
+    pop_front_deque_bulk(d, NULL, n);
+    return true;
+}
+
+void* get_deque_back_span(const Deque_t* d, size_t* count)
+{
+    // --- the free run starts at the back and stops at the end of the storage or the front ---
+    const size_t free_slots = d->capacity - d->count;
+    const size_t tail       = (d->head + d->count) & (d->capacity ? d->capacity - 1 : 0);
+    const size_t to_end     = d->capacity - tail;
+    *count                  = free_slots < to_end ? free_slots : to_end;
+    return free_slots ? slot_address(d, tail) : NULL;
+}
+
+bool commit_deque_back(Deque_t* d, const size_t n)
+{
+    size_t room;
+    get_deque_back_span(d, &room);
+    if (n > room) return false;
+
+    d->count += n;
+    return true;
+}
+
+bool clear_deque(Deque_t* d)
+{
+    // --- mark deque as empty (reuse existing storage) ---
+    d->head  = 0;
+    d->count = 0;
+    return true;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool free_deque(Deque_t* d)
+{
+    // --- nothing allocated yet ---
+    if (d->data == NULL) return false;
+
+    jester_deallocate(d->allocator, d->data, d->capacity * d->element_size);
+    d->data     = NULL;
+    d->head     = 0;
+    d->count    = 0;
+    d->capacity = 0;
+    return true;
+}
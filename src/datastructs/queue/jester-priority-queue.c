@@ -0,0 +1,313 @@
+﻿/**
+ * @file      jester-priority-queue.c
+ * @brief     Implementation of the d-ary heap priority queue for the Jester stdlib.
+ *
+ * @details   Node i has children (i << arity_shift) + 1 ... (i << arity_shift) + arity
+ *            and parent (i - 1) >> arity_shift. Sifts move a "hole" instead of
+ *            swapping: elements on the path are copied once into the hole, and
+ *            the moving element is written once at its final index. The moving
+ *            element therefore has to live outside the path: it is the caller's
+ *            buffer for push/update, or the old last element, which stays intact
+ *            one past the end of the heap, for pop/remove.
+ *
+ *            With handles, handles[i] names the element at heap index i and
+ *            positions[handle] points back at i; every copy into the hole keeps
+ *            both in step.
+ *
+ * @copyright GPL-3.0
+ * @author    Case Presley
+ * @date      10-17-2026
+ */
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include "jester/datastructs/queue/jester-priority-queue.h" // |
+#include <string.h>                                         // |
+//-------------------------------------------------------------┙
+
+static char* element_at(const PriorityQueue_t* q, const size_t index)
+{
+    return (char*)q->heap.data + (index * q->heap.element_size);
+}
+
+static size_t* handle_slots(const PriorityQueue_t* q)
+{
+    return (size_t*)q->handles.data;
+}
+
+static size_t* position_slots(const PriorityQueue_t* q)
+{
+    return (size_t*)q->positions.data;
+}
+
+// --- copy the element at from into the hole at to, keeping its handle pointed at it ---
+static void move_element(PriorityQueue_t* q, const size_t from, const size_t to)
+{
+    memcpy(element_at(q, to), element_at(q, from), q->heap.element_size);
+    if (!q->track_handles) return;
+
+    const size_t handle       = handle_slots(q)[from];
+    handle_slots(q)[to]       = handle;
+    position_slots(q)[handle] = to;
+}
+
+// --- write the moving element (and its handle) into the final hole ---
+static void place_element(PriorityQueue_t* q, const size_t index, const void* element, const size_t handle)
+{
+    memcpy(element_at(q, index), element, q->heap.element_size);
+    if (!q->track_handles) return;
+
+    handle_slots(q)[index]    = handle;
+    position_slots(q)[handle] = index;
+}
+
+// --- move the hole up past every parent that element beats; returns the final hole ---
+static size_t sift_up(PriorityQueue_t* q, size_t hole, const void* element)
+{
+    while (hole > 0)
+    {
+        const size_t parent = (hole - 1) >> q->arity_shift;
+        if (!q->less(element, element_at(q, parent))) break;
+
+        move_element(q, parent, hole);
+        hole = parent;
+    }
+    return hole;
+}
+
+// --- move the hole down past every best child that beats element; returns the final hole ---
+static size_t sift_down(PriorityQueue_t* q, size_t hole, const void* element)
+{
+    const size_t count = q->heap.count;
+    const size_t arity = (size_t)1 << q->arity_shift;
+
+    for (;;)
+    {
+        const size_t first = (hole << q->arity_shift) + 1;
+        if (first >= count) break;
+
+        // --- siblings are adjacent, so this scan stays within one or two cache lines ---
+        const size_t last = count - first < arity ? count : first + arity;
+        size_t best       = first;
+        for (size_t child = first + 1; child < last; child++)
+        {
+            if (q->less(element_at(q, child), element_at(q, best))) best = child;
+        }
+        if (!q->less(element_at(q, best), element)) break;
+
+        move_element(q, best, hole);
+        hole = best;
+    }
+    return hole;
+}
+
+// --- re-seat an element whose value changed at index, in whichever direction it has to go ---
+static void restore_heap(PriorityQueue_t* q, const size_t index, const void* element, const size_t handle)
+{
+    size_t hole = sift_up(q, index, element);
+    if (hole == index) hole = sift_down(q, index, element);
+    place_element(q, hole, element, handle);
+}
+
+// --- take a released handle, or mint a new one; returns false if a new one cannot be stored ---
+static bool acquire_handle(PriorityQueue_t* q, size_t* handle)
+{
+    if (pop_dynamic_array(&q->free_handles, handle)) return true;
+
+    *handle               = q->positions.count;
+    const size_t released = SIZE_MAX;
+    return push_dynamic_array(&q->positions, &released);
+}
+
+static void release_handle(PriorityQueue_t* q, const size_t handle)
+{
+    position_slots(q)[handle] = SIZE_MAX;
+
+    // --- if the free list cannot grow the handle is simply never reused ---
+    push_dynamic_array(&q->free_handles, &handle);
+}
+
+static bool is_valid_handle(const PriorityQueue_t* q, const PriorityQueueHandle_t handle)
+{
+    return q->track_handles && handle < q->positions.count && position_slots(q)[handle] != SIZE_MAX;
+}
+
+// --- unlink the element at index, filling its slot from the back of the heap ---
+static void remove_at(PriorityQueue_t* q, const size_t index, void* destination)
+{
+    if (destination) memcpy(destination, element_at(q, index), q->heap.element_size);
+    if (q->track_handles) release_handle(q, handle_slots(q)[index]);
+
+    // --- the old last element stays intact one past the end while it is re-seated ---
+    const size_t last = --q->heap.count;
+    if (q->track_handles) q->handles.count = last;
+    if (index == last) return;
+
+    const size_t handle = q->track_handles ? handle_slots(q)[last] : SIZE_MAX;
+    restore_heap(q, index, element_at(q, last), handle);
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+PriorityQueue_t create_priority_queue_custom(const size_t element_size, const JesterLessFn less, const size_t arity,
+                                             const bool track_handles, const JesterAllocator_t* allocator)
+{
+    PriorityQueue_t queue = {};  // initialize to defaults
+    queue.heap            = create_dynamic_array_with_allocator(element_size, 0, allocator);
+    queue.handles         = create_dynamic_array_with_allocator(sizeof(size_t), 0, allocator);
+    queue.positions       = create_dynamic_array_with_allocator(sizeof(size_t), 0, allocator);
+    queue.free_handles    = create_dynamic_array_with_allocator(sizeof(size_t), 0, allocator);
+    queue.less            = less;
+    queue.arity_shift     = arity == 8 ? 3 : arity == 4 ? 2 : 1;
+    queue.track_handles   = track_handles;
+    return queue;
+}
+
+PriorityQueue_t create_priority_queue(const size_t element_size, const JesterLessFn less)
+{
+    return create_priority_queue_custom(element_size, less, 2, false, NULL);
+}
+
+bool reserve_priority_queue(PriorityQueue_t* q, const size_t capacity)
+{
+    if (!reserve_dynamic_array(&q->heap, capacity)) return false;
+    return !q->track_handles || reserve_dynamic_array(&q->handles, capacity);
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool push_priority_queue(PriorityQueue_t* q, const void* element, PriorityQueueHandle_t* handle)
+{
+    size_t new_handle = JESTER_PRIORITY_QUEUE_INVALID_HANDLE;
+
+    // --- do every allocation first so a failure leaves the queue untouched ---
+    if (q->track_handles)
+    {
+        if (!acquire_handle(q, &new_handle)) return false;
+        if (!push_dynamic_array(&q->handles, &new_handle))
+        {
+            release_handle(q, new_handle);
+            return false;
+        }
+    }
+    if (!push_dynamic_array(&q->heap, element))
+    {
+        if (q->track_handles)
+        {
+            q->handles.count--;
+            release_handle(q, new_handle);
+        }
+        return false;
+    }
+
+    const size_t index = sift_up(q, q->heap.count - 1, element);
+    place_element(q, index, element, new_handle);
+
+    if (handle) *handle = new_handle;
+    return true;
+}
+
+const void* peek_priority_queue(const PriorityQueue_t* q)
+{
+    return q->heap.count ? q->heap.data : NULL;
+}
+
+bool pop_priority_queue(PriorityQueue_t* q, void* destination)
+{
+    if (q->heap.count == 0) return false;
+
+    remove_at(q, 0, destination);
+    return true;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool heapify_priority_queue(PriorityQueue_t* q, const void* source, const size_t count,
+                            PriorityQueueHandle_t* handles)
+{
+    const size_t old_count = q->heap.count;
+    if (count > SIZE_MAX - old_count - 1) return false;
+
+    // --- one spare slot past the end holds the element being sifted ---
+    const size_t total = old_count + count;
+    if (!reserve_dynamic_array(&q->heap, total + 1)) return false;
+    if (q->track_handles)
+    {
+        if (!reserve_dynamic_array(&q->handles, total)) return false;
+        if (!reserve_dynamic_array(&q->positions, q->positions.count + count)) return false;
+    }
+
+    append_dynamic_array(&q->heap, source, count);
+    for (size_t i = 0; q->track_handles && i < count; i++)
+    {
+        size_t handle;
+        acquire_handle(q, &handle);  // cannot fail, positions has room for every new handle
+        handle_slots(q)[old_count + i] = handle;
+        position_slots(q)[handle]      = old_count + i;
+        if (handles) handles[i] = handle;
+    }
+    if (q->track_handles) q->handles.count = total;
+
+    // --- Floyd: sift down every internal node, last parent first ---
+    char* spare = element_at(q, total);
+    for (size_t i = total > 1 ? ((total - 2) >> q->arity_shift) + 1 : 0; i-- > 0;)
+    {
+        memcpy(spare, element_at(q, i), q->heap.element_size);
+        const size_t handle = q->track_handles ? handle_slots(q)[i] : SIZE_MAX;
+        place_element(q, sift_down(q, i, spare), spare, handle);
+    }
+    return true;
+}
+
+bool update_priority_queue(PriorityQueue_t* q, const PriorityQueueHandle_t handle, const void* element)
+{
+    if (!is_valid_handle(q, handle)) return false;
+
+    restore_heap(q, position_slots(q)[handle], element, handle);
+    return true;
+}
+
+bool remove_priority_queue(PriorityQueue_t* q, const PriorityQueueHandle_t handle, void* destination)
+{
+    if (!is_valid_handle(q, handle)) return false;
+
+    remove_at(q, position_slots(q)[handle], destination);
+    return true;
+}
+
+const void* get_priority_queue_element(const PriorityQueue_t* q, const PriorityQueueHandle_t handle)
+{
+    return is_valid_handle(q, handle) ? element_at(q, position_slots(q)[handle]) : NULL;
+}
+
+size_t get_priority_queue_count(const PriorityQueue_t* q)
+{
+    return q->heap.count;
+}
+
+bool clear_priority_queue(PriorityQueue_t* q)
+{
+    clear_dynamic_array(&q->heap);
+    clear_dynamic_array(&q->handles);
+    clear_dynamic_array(&q->positions);
+    clear_dynamic_array(&q->free_handles);
+    return true;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool free_priority_queue(PriorityQueue_t* q)
+{
+    bool freed = free_dynamic_array(&q->heap);
+    freed |= free_dynamic_array(&q->handles);
+    freed |= free_dynamic_array(&q->positions);
+    freed |= free_dynamic_array(&q->free_handles);
+    return freed;
+}
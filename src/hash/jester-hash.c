@@ -0,0 +1,521 @@
+﻿/**
+ * @file      jester-hash.c
+ * @brief     Implementation of the 64-bit non-cryptographic hash for the Jester stdlib.
+ *
+ * @details   Length classes:
+ *            - 0..16 bytes: overlapping head/tail reads mixed by one
+ *              128-bit multiply (or a bijective finalizer for <= 8 bytes).
+ *            - 17..256 bytes: 16-byte pairs, each folded through a keyed
+ *              128-bit multiply, summed from both ends inwards.
+ *            - longer: eight 64-bit accumulators take one 64-byte stripe at a
+ *              time (acc[i] += lo32(d ^ k) * hi32(d ^ k), acc[i ^ 1] += d), the
+ *              secret window slides 8 bytes per stripe, and every 16 stripes
+ *              (a block) the accumulators are scrambled. The last stripe is
+ *              always the final 64 input bytes, so at least one byte is held
+ *              back from the stripe loop; the streaming code keeps the same
+ *              invariant, which is what makes both paths agree.
+ *
+ * @copyright GPL-3.0
+ * @author    Case Presley
+ * @date      10-17-2026
+ */
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include "jester/hash/jester-hash.h"                       // |
+#include <stdbool.h>                                       // |
+#include <string.h>                                        // |
+#if defined(__x86_64__) || defined(__i386__)               // |
+#include <immintrin.h>                                     // |
+#endif                                                     // |
+//------------------------------------------------------------┙
+
+#define STRIPE_SIZE        64
+#define STRIPES_PER_BLOCK  ((JESTER_HASH_SECRET_SIZE - STRIPE_SIZE) / 8)
+#define SCRAMBLE_OFFSET    (JESTER_HASH_SECRET_SIZE - STRIPE_SIZE)
+#define LAST_STRIPE_OFFSET (JESTER_HASH_SECRET_SIZE - STRIPE_SIZE - 7)
+
+#define PRIME32_1 0x9E3779B1U
+#define PRIME32_2 0x85EBCA77U
+#define PRIME32_3 0xC2B2AE3DU
+#define PRIME64_1 0x9E3779B185EBCA87ULL
+#define PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define PRIME64_3 0x165667B19E3779F9ULL
+#define PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define PRIME64_5 0x27D4EB2F165667C5ULL
+
+// --- random bytes (splitmix64 output), keying every length class ---
+static const unsigned char default_secret[JESTER_HASH_SECRET_SIZE] = {
+    0x9E, 0x1B, 0xDE, 0xA5, 0x40, 0x5D, 0xE7, 0x72, 0x48, 0x41, 0x06, 0xDE, 0xCE, 0x99, 0xAC, 0x38,
+    0xBE, 0xE0, 0xC5, 0xFB, 0x1C, 0xB4, 0xEF, 0x58, 0xA2, 0xA6, 0x75, 0x5C, 0x0D, 0x2F, 0x14, 0xBB,
+    0xBA, 0x7C, 0x90, 0xB2, 0x2F, 0x07, 0x7F, 0xAB, 0x8C, 0x6B, 0xC2, 0xF4, 0x73, 0x07, 0xEF, 0x98,
+    0x20, 0x7E, 0x5A, 0x25, 0xEB, 0x6C, 0x6E, 0xE6, 0x05, 0x6E, 0xEB, 0xF7, 0x5C, 0x49, 0x19, 0x5F,
+    0x98, 0x66, 0x1A, 0x9E, 0xEE, 0x94, 0x8C, 0x07, 0x95, 0xD9, 0xB8, 0x11, 0xAA, 0xFB, 0x55, 0x16,
+    0xCA, 0xDF, 0xCF, 0x63, 0xB0, 0x5D, 0xD2, 0x05, 0x42, 0xBB, 0xE0, 0xC1, 0x86, 0xF4, 0xDF, 0xFF,
+    0x8A, 0x5F, 0xD8, 0x48, 0x6E, 0x8E, 0x49, 0xFE, 0x14, 0xFB, 0xFA, 0xC5, 0xF2, 0xA5, 0x4F, 0x68,
+    0x84, 0x6F, 0x32, 0xC1, 0x61, 0xE2, 0x5F, 0x0A, 0x5E, 0x63, 0x92, 0xBC, 0x69, 0x83, 0x76, 0xAB,
+    0x47, 0xBA, 0x9A, 0x82, 0xF6, 0xC0, 0x6D, 0xCC, 0xD3, 0xC4, 0x95, 0x0E, 0xA2, 0xB4, 0x23, 0x71,
+    0x46, 0x46, 0xE2, 0x01, 0x17, 0x2A, 0xAF, 0x52, 0x9A, 0xCF, 0xDE, 0x16, 0xD7, 0x9A, 0xE2, 0x5C,
+    0x57, 0xAF, 0xBE, 0xB0, 0x40, 0x56, 0x98, 0x9A, 0x7A, 0xCC, 0x1C, 0x23, 0xC6, 0xA9, 0x54, 0xFE,
+    0x9A, 0xD1, 0x6E, 0x23, 0x74, 0xF2, 0x66, 0x99, 0x7D, 0xBF, 0x44, 0xCA, 0x35, 0x01, 0x7E, 0x1D
+};
+
+typedef void (*AccumulateFn)(uint64_t* accumulators, const unsigned char* input, const unsigned char* secret,
+                             size_t stripes);
+typedef void (*ScrambleFn)(uint64_t* accumulators, const unsigned char* secret);
+
+typedef struct HashKernels
+{
+    AccumulateFn accumulate;
+    ScrambleFn scramble;
+} HashKernels_t;
+
+static uint64_t read64(const unsigned char* p)
+{
+    uint64_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static uint32_t read32(const unsigned char* p)
+{
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static void write64(unsigned char* p, const uint64_t value)
+{
+    memcpy(p, &value, sizeof(value));
+}
+
+// --- 64x64 -> 128-bit multiply, high and low halves xor-folded ---
+static uint64_t fold_multiply(const uint64_t a, const uint64_t b)
+{
+    const __uint128_t product = (__uint128_t)a * b;
+    return (uint64_t)product ^ (uint64_t)(product >> 64);
+}
+
+static uint64_t avalanche(uint64_t h)
+{
+    h ^= h >> 37;
+    h *= 0x165667919E3779F9ULL;
+    h ^= h >> 32;
+    return h;
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+// Short and medium inputs
+// ---------------------------------------------------------------------------------------------------------------
+
+static uint64_t hash_0_to_16(const unsigned char* p, const size_t size, const unsigned char* s, const uint64_t seed)
+{
+    if (size > 8)
+    {
+        const uint64_t low  = read64(p) ^ (read64(s + 24) + seed);
+        const uint64_t high = read64(p + size - 8) ^ (read64(s + 32) - seed);
+        return avalanche(size + __builtin_bswap64(low) + high + fold_multiply(low, high));
+    }
+    if (size >= 4)
+    {
+        const uint64_t value = read32(p + size - 4) + ((uint64_t)read32(p) << 32);
+        const uint64_t keyed = value ^ ((read64(s + 8) ^ read64(s + 16)) - seed);
+        return jester_hash_u64(keyed ^ (size * PRIME64_2));
+    }
+    if (size > 0)
+    {
+        const uint32_t combined = ((uint32_t)p[0] << 16) | ((uint32_t)p[size >> 1] << 24) | p[size - 1] |
+                                  ((uint32_t)size << 8);
+        return jester_hash_u64(combined ^ (((uint64_t)read32(s) ^ read32(s + 4)) + seed));
+    }
+    return jester_hash_u64(seed ^ read64(s + 56) ^ read64(s + 64));
+}
+
+static uint64_t mix16(const unsigned char* p, const unsigned char* s, const uint64_t seed)
+{
+    return fold_multiply(read64(p) ^ (read64(s) + seed), read64(p + 8) ^ (read64(s + 8) - seed));
+}
+
+static uint64_t hash_17_to_128(const unsigned char* p, const size_t size, const unsigned char* s,
+                               const uint64_t seed)
+{
+    uint64_t acc = size * PRIME64_1;
+    if (size > 32)
+    {
+        if (size > 64)
+        {
+            if (size > 96)
+            {
+                acc += mix16(p + 48, s + 96, seed);
+                acc += mix16(p + size - 64, s + 112, seed);
+            }
+            acc += mix16(p + 32, s + 64, seed);
+            acc += mix16(p + size - 48, s + 80, seed);
+        }
+        acc += mix16(p + 16, s + 32, seed);
+        acc += mix16(p + size - 32, s + 48, seed);
+    }
+    acc += mix16(p, s, seed);
+    acc += mix16(p + size - 16, s + 16, seed);
+    return avalanche(acc);
+}
+
+static uint64_t hash_129_to_256(const unsigned char* p, const size_t size, const unsigned char* s,
+                                const uint64_t seed)
+{
+    uint64_t acc = size * PRIME64_1;
+    for (size_t i = 0; i < 8; i++) acc += mix16(p + (16 * i), s + (16 * i), seed);
+    acc = avalanche(acc);
+
+    // --- remaining whole pairs use the secret shifted by 3 so they never line up with the first eight ---
+    for (size_t i = 8; i < size / 16; i++) acc += mix16(p + (16 * i), s + (16 * (i - 8)) + 3, seed);
+    acc += mix16(p + size - 16, s + 119, seed);
+    return avalanche(acc);
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+// Long inputs: stripe kernels
+// ---------------------------------------------------------------------------------------------------------------
+
+static void accumulate_scalar(uint64_t* acc, const unsigned char* p, const unsigned char* s, const size_t stripes)
+{
+    for (size_t n = 0; n < stripes; n++, p += STRIPE_SIZE, s += 8)
+    {
+        for (size_t i = 0; i < 8; i++)
+        {
+            const uint64_t data = read64(p + (8 * i));
+            const uint64_t key  = data ^ read64(s + (8 * i));
+            acc[i ^ 1] += data;
+            acc[i] += (key & 0xFFFFFFFFULL) * (key >> 32);
+        }
+    }
+}
+
+static void scramble_scalar(uint64_t* acc, const unsigned char* s)
+{
+    for (size_t i = 0; i < 8; i++)
+    {
+        uint64_t a = acc[i];
+        a ^= a >> 47;
+        a ^= read64(s + (8 * i));
+        acc[i] = a * PRIME32_1;
+    }
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+__attribute__((target("sse2"))) static void accumulate_sse2(uint64_t* acc, const unsigned char* p,
+                                                            const unsigned char* s, const size_t stripes)
+{
+    __m128i* lanes = (__m128i*)acc;
+    __m128i a[4];
+    for (size_t i = 0; i < 4; i++) a[i] = _mm_load_si128(lanes + i);
+
+    for (size_t n = 0; n < stripes; n++, p += STRIPE_SIZE, s += 8)
+    {
+        for (size_t i = 0; i < 4; i++)
+        {
+            const __m128i data    = _mm_loadu_si128((const __m128i*)(p + (16 * i)));
+            const __m128i key     = _mm_xor_si128(data, _mm_loadu_si128((const __m128i*)(s + (16 * i))));
+            const __m128i product = _mm_mul_epu32(key, _mm_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1)));
+            const __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+            a[i]                  = _mm_add_epi64(a[i], _mm_add_epi64(product, swapped));
+        }
+    }
+
+    for (size_t i = 0; i < 4; i++) _mm_store_si128(lanes + i, a[i]);
+}
+
+__attribute__((target("sse2"))) static void scramble_sse2(uint64_t* acc, const unsigned char* s)
+{
+    __m128i* lanes      = (__m128i*)acc;
+    const __m128i prime = _mm_set1_epi32((int)PRIME32_1);
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        __m128i a = _mm_load_si128(lanes + i);
+        a         = _mm_xor_si128(a, _mm_srli_epi64(a, 47));
+        a         = _mm_xor_si128(a, _mm_loadu_si128((const __m128i*)(s + (16 * i))));
+
+        // --- 64 x 32-bit multiply from two 32 x 32 -> 64 products ---
+        const __m128i low  = _mm_mul_epu32(a, prime);
+        const __m128i high = _mm_mul_epu32(_mm_shuffle_epi32(a, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+        _mm_store_si128(lanes + i, _mm_add_epi64(low, _mm_slli_epi64(high, 32)));
+    }
+}
+
+__attribute__((target("avx2"))) static void accumulate_avx2(uint64_t* acc, const unsigned char* p,
+                                                            const unsigned char* s, const size_t stripes)
+{
+    __m256i* lanes = (__m256i*)acc;
+    __m256i a[2];
+    for (size_t i = 0; i < 2; i++) a[i] = _mm256_load_si256(lanes + i);
+
+    for (size_t n = 0; n < stripes; n++, p += STRIPE_SIZE, s += 8)
+    {
+        for (size_t i = 0; i < 2; i++)
+        {
+            const __m256i data    = _mm256_loadu_si256((const __m256i*)(p + (32 * i)));
+            const __m256i key     = _mm256_xor_si256(data, _mm256_loadu_si256((const __m256i*)(s + (32 * i))));
+            const __m256i product = _mm256_mul_epu32(key, _mm256_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1)));
+            const __m256i swapped = _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+            a[i]                  = _mm256_add_epi64(a[i], _mm256_add_epi64(product, swapped));
+        }
+    }
+
+    for (size_t i = 0; i < 2; i++) _mm256_store_si256(lanes + i, a[i]);
+}
+
+__attribute__((target("avx2"))) static void scramble_avx2(uint64_t* acc, const unsigned char* s)
+{
+    __m256i* lanes      = (__m256i*)acc;
+    const __m256i prime = _mm256_set1_epi32((int)PRIME32_1);
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        __m256i a = _mm256_load_si256(lanes + i);
+        a         = _mm256_xor_si256(a, _mm256_srli_epi64(a, 47));
+        a         = _mm256_xor_si256(a, _mm256_loadu_si256((const __m256i*)(s + (32 * i))));
+
+        const __m256i low  = _mm256_mul_epu32(a, prime);
+        const __m256i high = _mm256_mul_epu32(_mm256_shuffle_epi32(a, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+        _mm256_store_si256(lanes + i, _mm256_add_epi64(low, _mm256_slli_epi64(high, 32)));
+    }
+}
+
+#endif
+
+static const HashKernels_t scalar_kernels = {accumulate_scalar, scramble_scalar};
+#if defined(__x86_64__) || defined(__i386__)
+static const HashKernels_t sse2_kernels = {accumulate_sse2, scramble_sse2};
+static const HashKernels_t avx2_kernels = {accumulate_avx2, scramble_avx2};
+#endif
+
+// --- set by jester_hash_set_kernel(), NULL picks per CPU ---
+static const HashKernels_t* pinned_kernels = NULL;
+
+// --- kernels for a choice (AUTO = widest the CPU supports), or NULL if unavailable here ---
+static const HashKernels_t* find_kernels(const JesterHashKernel_t kernel)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+    const bool avx2 = __builtin_cpu_supports("avx2");
+    const bool sse2 = __builtin_cpu_supports("sse2");
+
+    switch (kernel)
+    {
+        case JESTER_HASH_KERNEL_AUTO:
+            return avx2 ? &avx2_kernels : sse2 ? &sse2_kernels : &scalar_kernels;
+
+        case JESTER_HASH_KERNEL_SCALAR:
+            return &scalar_kernels;
+
+        case JESTER_HASH_KERNEL_SSE2:
+            return sse2 ? &sse2_kernels : NULL;
+
+        case JESTER_HASH_KERNEL_AVX2:
+            return avx2 ? &avx2_kernels : NULL;
+
+        default:
+            return NULL;
+    }
+#else
+    return kernel == JESTER_HASH_KERNEL_AUTO || kernel == JESTER_HASH_KERNEL_SCALAR ? &scalar_kernels : NULL;
+#endif
+}
+
+static const HashKernels_t* select_kernels(void)
+{
+    return pinned_kernels ? pinned_kernels : find_kernels(JESTER_HASH_KERNEL_AUTO);
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+// Long inputs: driver shared by the one-shot and streaming paths
+// ---------------------------------------------------------------------------------------------------------------
+
+static void init_accumulators(uint64_t* acc)
+{
+    const uint64_t initial[8] = {PRIME32_3, PRIME64_1, PRIME64_2, PRIME64_3,
+                                 PRIME64_4, PRIME32_2, PRIME64_5, PRIME32_1};
+    memcpy(acc, initial, sizeof(initial));
+}
+
+// --- secret words offset by +seed / -seed alternately; seed 0 keeps the default ---
+static void derive_secret(unsigned char* secret, const uint64_t seed)
+{
+    for (size_t i = 0; i < JESTER_HASH_SECRET_SIZE; i += 16)
+    {
+        write64(secret + i, read64(default_secret + i) + seed);
+        write64(secret + i + 8, read64(default_secret + i + 8) - seed);
+    }
+}
+
+// --- feed whole stripes, scrambling after every full block; the caller holds back at least one byte ---
+static void consume_stripes(const HashKernels_t* kernels, uint64_t* acc, size_t* block_stripes,
+                            const unsigned char* p, size_t stripes, const unsigned char* secret)
+{
+    while (stripes)
+    {
+        const size_t room  = STRIPES_PER_BLOCK - *block_stripes;
+        const size_t taken = stripes < room ? stripes : room;
+
+        kernels->accumulate(acc, p, secret + (8 * *block_stripes), taken);
+        p += taken * STRIPE_SIZE;
+        stripes -= taken;
+        *block_stripes += taken;
+
+        if (*block_stripes == STRIPES_PER_BLOCK)
+        {
+            kernels->scramble(acc, secret + SCRAMBLE_OFFSET);
+            *block_stripes = 0;
+        }
+    }
+}
+
+static uint64_t merge_accumulators(const uint64_t* acc, const unsigned char* secret, const uint64_t size)
+{
+    uint64_t result = size * PRIME64_1;
+    for (size_t i = 0; i < 4; i++)
+    {
+        result += fold_multiply(acc[2 * i] ^ read64(secret + 11 + (16 * i)),
+                                acc[(2 * i) + 1] ^ read64(secret + 19 + (16 * i)));
+    }
+    return avalanche(result);
+}
+
+static uint64_t hash_long(const unsigned char* p, const size_t size, const unsigned char* secret)
+{
+    const HashKernels_t* kernels = select_kernels();
+
+    _Alignas(32) uint64_t acc[8];
+    size_t block_stripes = 0;
+    init_accumulators(acc);
+
+    consume_stripes(kernels, acc, &block_stripes, p, (size - 1) / STRIPE_SIZE, secret);
+    kernels->accumulate(acc, p + size - STRIPE_SIZE, secret + LAST_STRIPE_OFFSET, 1);
+    return merge_accumulators(acc, secret, size);
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+// Public API
+// ---------------------------------------------------------------------------------------------------------------
+
+uint64_t jester_hash(const void* data, const size_t size, const uint64_t seed)
+{
+    const unsigned char* p = data;
+
+    if (size <= 16) return hash_0_to_16(p, size, default_secret, seed);
+    if (size <= 128) return hash_17_to_128(p, size, default_secret, seed);
+    if (size <= JESTER_HASH_BUFFER_SIZE) return hash_129_to_256(p, size, default_secret, seed);
+    if (seed == 0) return hash_long(p, size, default_secret);
+
+    unsigned char secret[JESTER_HASH_SECRET_SIZE];
+    derive_secret(secret, seed);
+    return hash_long(p, size, secret);
+}
+
+uint64_t jester_hash_u64(uint64_t value)
+{
+    // --- moremur finalizer ---
+    value ^= value >> 27;
+    value *= 0x3C79AC492BA7B653ULL;
+    value ^= value >> 33;
+    value *= 0x1C69B3F74AC4AE35ULL;
+    value ^= value >> 27;
+    return value;
+}
+
+uint64_t jester_hash_combine(const uint64_t seed, const uint64_t hash)
+{
+    return jester_hash_u64(seed ^ (hash + 0x9E3779B97F4A7C15ULL + (seed << 6) + (seed >> 2)));
+}
+
+void jester_hash_init(JesterHashState_t* state, const uint64_t seed)
+{
+    memset(state, 0, sizeof(*state));
+    state->seed = seed;
+    derive_secret(state->secret, seed);
+    init_accumulators(state->accumulators);
+}
+
+void jester_hash_update(JesterHashState_t* state, const void* data, size_t size)
+{
+    const unsigned char* p = data;
+    if (size == 0) return;
+    state->total += size;
+
+    // --- everything still fits: keep buffering (inputs up to the buffer size never reach the stripe loop) ---
+    if (state->buffered + size <= JESTER_HASH_BUFFER_SIZE)
+    {
+        memcpy(state->buffer + state->buffered, p, size);
+        state->buffered += size;
+        return;
+    }
+
+    const HashKernels_t* kernels = select_kernels();
+
+    // --- top the buffer up and consume it whole, more input follows ---
+    if (state->buffered)
+    {
+        const size_t fill = JESTER_HASH_BUFFER_SIZE - state->buffered;
+        memcpy(state->buffer + state->buffered, p, fill);
+        p += fill;
+        size -= fill;
+
+        consume_stripes(kernels, state->accumulators, &state->stripes, state->buffer,
+                        JESTER_HASH_BUFFER_SIZE / STRIPE_SIZE, state->secret);
+        memcpy(state->previous, state->buffer + JESTER_HASH_BUFFER_SIZE - STRIPE_SIZE, STRIPE_SIZE);
+        state->buffered = 0;
+    }
+
+    // --- consume straight from the input, holding back 1..64 bytes ---
+    if (size > JESTER_HASH_BUFFER_SIZE)
+    {
+        const size_t stripes = (size - 1) / STRIPE_SIZE;
+        consume_stripes(kernels, state->accumulators, &state->stripes, p, stripes, state->secret);
+        memcpy(state->previous, p + (stripes * STRIPE_SIZE) - STRIPE_SIZE, STRIPE_SIZE);
+        p += stripes * STRIPE_SIZE;
+        size -= stripes * STRIPE_SIZE;
+    }
+
+    memcpy(state->buffer, p, size);
+    state->buffered = size;
+}
+
+uint64_t jester_hash_final(const JesterHashState_t* state)
+{
+    // --- short inputs never left the buffer ---
+    if (state->total <= JESTER_HASH_BUFFER_SIZE) return jester_hash(state->buffer, (size_t)state->total, state->seed);
+
+    const HashKernels_t* kernels = select_kernels();
+
+    _Alignas(32) uint64_t acc[8];
+    size_t block_stripes = state->stripes;
+    memcpy(acc, state->accumulators, sizeof(acc));
+
+    consume_stripes(kernels, acc, &block_stripes, state->buffer, (state->buffered - 1) / STRIPE_SIZE, state->secret);
+
+    // --- the last stripe is the final 64 bytes, reaching back into consumed input if the buffer is short ---
+    unsigned char last[STRIPE_SIZE];
+    if (state->buffered >= STRIPE_SIZE)
+    {
+        memcpy(last, state->buffer + state->buffered - STRIPE_SIZE, STRIPE_SIZE);
+    }
+    else
+    {
+        const size_t reach = STRIPE_SIZE - state->buffered;
+        memcpy(last, state->previous + STRIPE_SIZE - reach, reach);
+        memcpy(last + reach, state->buffer, state->buffered);
+    }
+
+    kernels->accumulate(acc, last, state->secret + LAST_STRIPE_OFFSET, 1);
+    return merge_accumulators(acc, state->secret, state->total);
+}
+
+bool jester_hash_set_kernel(const JesterHashKernel_t kernel)
+{
+    const HashKernels_t* kernels = find_kernels(kernel);
+    if (kernels == NULL) return false;
+
+    pinned_kernels = kernel == JESTER_HASH_KERNEL_AUTO ? NULL : kernels;
+    return true;
+}
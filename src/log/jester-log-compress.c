@@ -0,0 +1,533 @@
+﻿#include "jester/log/jester-log-compress.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define BLOCK_MAGIC  0x424C5A4Au  // "JLZB"
+#define INDEX_MAGIC  0x494C5A4Au  // "JLZI"
+#define FOOTER_MAGIC 0x454C5A4Au  // "JLZE"
+
+#define BLOCK_HEADER_SIZE 16
+#define INDEX_ENTRY_SIZE  24
+#define FOOTER_SIZE       16
+#define BLOCK_STORED      1u      // payload is the raw bytes, compression did not pay off
+
+#define MIN_MATCH     4
+#define LAST_LITERALS 5
+#define MAX_OFFSET    65535
+#define HASH_BITS     12
+
+static void put_u32(unsigned char* p, const uint32_t v)
+{
+    p[0] = (unsigned char)v;
+    p[1] = (unsigned char)(v >> 8);
+    p[2] = (unsigned char)(v >> 16);
+    p[3] = (unsigned char)(v >> 24);
+}
+
+static void put_u64(unsigned char* p, const uint64_t v)
+{
+    put_u32(p, (uint32_t)v);
+    put_u32(p + 4, (uint32_t)(v >> 32));
+}
+
+static uint32_t get_u32(const unsigned char* p)
+{
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static uint64_t get_u64(const unsigned char* p)
+{
+    return (uint64_t)get_u32(p) | (uint64_t)get_u32(p + 4) << 32;
+}
+
+static uint32_t read32(const unsigned char* p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+// Block codec. A block is a list of sequences:
+//   token:u8  (literal length << 4 | (match length - MIN_MATCH))
+//   [length extension bytes for literals, 255 = continue]
+//   literals
+//   offset:u16 le
+//   [length extension bytes for the match]
+// The final sequence carries literals only and ends exactly at the end of the block.
+// ---------------------------------------------------------------------------------------------------------------
+
+size_t log_compress_bound(const size_t size)
+{
+    return size + size / 255 + 16;
+}
+
+static unsigned char* put_length(unsigned char* op, size_t length)
+{
+    while (length >= 255)
+    {
+        *op++ = 255;
+        length -= 255;
+    }
+    *op++ = (unsigned char)length;
+    return op;
+}
+
+static unsigned char* emit_sequence(unsigned char* op, const unsigned char* literals, const size_t literal_len,
+                                    const size_t offset, const size_t match_len)
+{
+    unsigned char* token = op++;
+    *token = (unsigned char)((literal_len >= 15 ? 15 : literal_len) << 4);
+    if (literal_len >= 15) op = put_length(op, literal_len - 15);
+
+    memcpy(op, literals, literal_len);
+    op += literal_len;
+
+    if (match_len == 0) return op;  // final literal-only sequence
+
+    *op++ = (unsigned char)offset;
+    *op++ = (unsigned char)(offset >> 8);
+
+    const size_t code = match_len - MIN_MATCH;
+    *token |= (unsigned char)(code >= 15 ? 15 : code);
+    if (code >= 15) op = put_length(op, code - 15);
+
+    return op;
+}
+
+size_t log_compress_block(const void* src, const size_t size, void* dst, const size_t capacity)
+{
+    if (capacity < log_compress_bound(size)) return 0;
+
+    const unsigned char* in = src;
+    unsigned char* op       = dst;
+    uint32_t table[1u << HASH_BITS];
+    memset(table, 0, sizeof(table));
+
+    size_t ip     = 0;
+    size_t anchor = 0;
+    size_t misses = 0;
+
+    // --- matches may not start within the trailing literal zone ---
+    const size_t match_limit = size > MIN_MATCH + LAST_LITERALS ? size - MIN_MATCH - LAST_LITERALS : 0;
+
+    while (ip < match_limit)
+    {
+        const uint32_t sequence = read32(in + ip);
+        const uint32_t hash     = (sequence * 2654435761u) >> (32 - HASH_BITS);
+        const size_t candidate  = table[hash];
+        table[hash]             = (uint32_t)ip;
+
+        if (candidate < ip && ip - candidate <= MAX_OFFSET && read32(in + candidate) == sequence)
+        {
+            size_t match_len = MIN_MATCH;
+            while (ip + match_len < size - LAST_LITERALS && in[candidate + match_len] == in[ip + match_len]) match_len++;
+
+            op = emit_sequence(op, in + anchor, ip - anchor, ip - candidate, match_len);
+            ip += match_len;
+            anchor = ip;
+            misses = 0;
+        }
+        else
+        {
+            ip += 1 + (misses++ >> 6);  // skip faster through incompressible data
+        }
+    }
+
+    op = emit_sequence(op, in + anchor, size - anchor, 0, 0);
+    return (size_t)(op - (unsigned char*)dst);
+}
+
+static bool get_length(const unsigned char** ip, const unsigned char* end, size_t* length)
+{
+    unsigned char byte;
+    do
+    {
+        if (*ip >= end) return false;
+        byte = *(*ip)++;
+        *length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+size_t log_decompress_block(const void* src, const size_t size, void* dst, const size_t capacity)
+{
+    const unsigned char* ip  = src;
+    const unsigned char* end = ip + size;
+    unsigned char* out       = dst;
+    size_t op                = 0;
+
+    while (ip < end)
+    {
+        const unsigned char token = *ip++;
+
+        // --- literals ---
+        size_t literal_len = token >> 4;
+        if (literal_len == 15 && !get_length(&ip, end, &literal_len)) return 0;
+        if (literal_len > (size_t)(end - ip) || literal_len > capacity - op) return 0;
+        memcpy(out + op, ip, literal_len);
+        ip += literal_len;
+        op += literal_len;
+
+        if (ip == end) break;  // final sequence
+
+        // --- match ---
+        if (end - ip < 2) return 0;
+        const size_t offset = (size_t)ip[0] | (size_t)ip[1] << 8;
+        ip += 2;
+
+        size_t match_len = token & 15u;
+        if (match_len == 15 && !get_length(&ip, end, &match_len)) return 0;
+        match_len += MIN_MATCH;
+
+        if (offset == 0 || offset > op || match_len > capacity - op) return 0;
+        const unsigned char* ref = out + op - offset;
+        for (size_t i = 0; i < match_len; i++) out[op + i] = ref[i];  // byte-wise, matches may overlap
+        op += match_len;
+    }
+
+    return op;
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+// Reader
+// ---------------------------------------------------------------------------------------------------------------
+
+static bool read_index_from_footer(FILE* file, const uint64_t file_size, DynamicArray_t* index)
+{
+    unsigned char footer[FOOTER_SIZE];
+    if (file_size < FOOTER_SIZE + 8) return false;
+    if (fseeko(file, (off_t)(file_size - FOOTER_SIZE), SEEK_SET) != 0) return false;
+    if (fread(footer, 1, FOOTER_SIZE, file) != FOOTER_SIZE || get_u32(footer + 8) != FOOTER_MAGIC) return false;
+
+    const uint64_t index_offset = get_u64(footer);
+    unsigned char header[8];
+    if (index_offset > file_size - FOOTER_SIZE - 8) return false;
+    if (fseeko(file, (off_t)index_offset, SEEK_SET) != 0) return false;
+    if (fread(header, 1, 8, file) != 8 || get_u32(header) != INDEX_MAGIC) return false;
+
+    const uint32_t count = get_u32(header + 4);
+    if (index_offset + 8 + (uint64_t)count * INDEX_ENTRY_SIZE + FOOTER_SIZE != file_size) return false;
+    if (!reserve_dynamic_array(index, count)) return false;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        unsigned char raw_entry[INDEX_ENTRY_SIZE];
+        if (fread(raw_entry, 1, INDEX_ENTRY_SIZE, file) != INDEX_ENTRY_SIZE) return false;
+
+        const LogBlockIndex_t entry = {
+            .file_offset = get_u64(raw_entry),
+            .raw_offset  = get_u64(raw_entry + 8),
+            .raw_size    = get_u32(raw_entry + 16),
+            .packed_size = get_u32(raw_entry + 20)
+        };
+        if (!push_dynamic_array(index, &entry)) return false;
+    }
+    return true;
+}
+
+// --- offset of the next block header at or after from, or file_size if there is none ---
+static uint64_t find_next_block(FILE* file, uint64_t from, const uint64_t file_size)
+{
+    unsigned char chunk[4096];
+    while (from + 4 <= file_size)
+    {
+        if (fseeko(file, (off_t)from, SEEK_SET) != 0) break;
+        const size_t got = fread(chunk, 1, sizeof(chunk), file);
+        if (got < 4) break;
+
+        for (size_t i = 0; i + 4 <= got; i++)
+        {
+            if (get_u32(chunk + i) == BLOCK_MAGIC) return from + i;
+        }
+        from += got - 3;  // a header may straddle two chunks
+    }
+    return file_size;
+}
+
+// --- a block is intact if it fits in the file and is followed by another record or the end of the file ---
+static bool is_intact_block(FILE* file, const uint64_t offset, const uint64_t file_size, const unsigned char* header)
+{
+    const uint32_t raw_size    = get_u32(header + 8);
+    const uint32_t packed_size = get_u32(header + 12);
+    if (raw_size > LOG_COMPRESS_BLOCK_SIZE || packed_size > log_compress_bound(raw_size)) return false;
+
+    const uint64_t next = offset + BLOCK_HEADER_SIZE + packed_size;
+    if (next > file_size) return false;
+    if (next + 4 > file_size) return next == file_size;
+
+    unsigned char magic[4];
+    if (fseeko(file, (off_t)next, SEEK_SET) != 0 || fread(magic, 1, 4, file) != 4) return false;
+    return get_u32(magic) == BLOCK_MAGIC || get_u32(magic) == INDEX_MAGIC;
+}
+
+// --- rebuilds the index from block headers; valid_end receives the end of the last intact record ---
+static bool scan_index(FILE* file, const uint64_t file_size, DynamicArray_t* index, uint64_t* valid_end)
+{
+    uint64_t offset     = 0;
+    uint64_t raw_offset = 0;
+    *valid_end          = 0;
+
+    while (offset + 8 <= file_size)
+    {
+        unsigned char header[BLOCK_HEADER_SIZE];
+        if (fseeko(file, (off_t)offset, SEEK_SET) != 0 || fread(header, 1, 8, file) != 8) return false;
+
+        if (get_u32(header) == INDEX_MAGIC)
+        {
+            // --- index left behind by an earlier session, skip it ---
+            const uint64_t size = 8 + (uint64_t)get_u32(header + 4) * INDEX_ENTRY_SIZE + FOOTER_SIZE;
+            if (size <= file_size - offset)
+            {
+                offset += size;
+                *valid_end = offset;
+                continue;
+            }
+        }
+        else if (get_u32(header) == BLOCK_MAGIC && fread(header + 8, 1, 8, file) == 8
+                 && is_intact_block(file, offset, file_size, header))
+        {
+            const LogBlockIndex_t entry = {
+                .file_offset = offset,
+                .raw_offset  = raw_offset,
+                .raw_size    = get_u32(header + 8),
+                .packed_size = get_u32(header + 12)
+            };
+            if (!push_dynamic_array(index, &entry)) return false;
+
+            offset += BLOCK_HEADER_SIZE + entry.packed_size;
+            raw_offset += entry.raw_size;
+            *valid_end = offset;
+            continue;
+        }
+
+        // --- a block cut short by a crash, possibly with later sessions appended after it: resync ---
+        offset = find_next_block(file, offset + 1, file_size);
+    }
+    return true;
+}
+
+// --- valid_end receives where intact data ends; anything past it is a torn tail ---
+static bool read_index(FILE* file, DynamicArray_t* index, uint64_t* valid_end)
+{
+    *index = create_dynamic_array(sizeof(LogBlockIndex_t), 16);
+    if (index->data == NULL) return false;
+
+    if (fseeko(file, 0, SEEK_END) != 0) return false;
+    const off_t end = ftello(file);
+    if (end < 0) return false;
+
+    *valid_end = (uint64_t)end;
+    if (read_index_from_footer(file, (uint64_t)end, index)) return true;
+
+    clear_dynamic_array(index);
+    return scan_index(file, (uint64_t)end, index, valid_end);
+}
+
+bool log_compressed_read_index(FILE* file, DynamicArray_t* index)
+{
+    uint64_t valid_end;
+    return read_index(file, index, &valid_end);
+}
+
+const LogBlockIndex_t* log_compressed_find_block(const DynamicArray_t* index, const uint64_t raw_offset)
+{
+    // --- binary search for the last block starting at or before raw_offset ---
+    size_t lo = 0;
+    size_t hi = index->count;
+    while (lo < hi)
+    {
+        const size_t mid = lo + (hi - lo) / 2;
+        const LogBlockIndex_t* entry = get_dynamic_array_element(index, mid);
+        if (entry->raw_offset <= raw_offset) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo == 0) return NULL;
+
+    const LogBlockIndex_t* entry = get_dynamic_array_element(index, lo - 1);
+    return raw_offset < entry->raw_offset + entry->raw_size ? entry : NULL;
+}
+
+bool log_compressed_read_block(FILE* file, const LogBlockIndex_t* entry, void* out)
+{
+    unsigned char header[BLOCK_HEADER_SIZE];
+    if (fseeko(file, (off_t)entry->file_offset, SEEK_SET) != 0) return false;
+    if (fread(header, 1, BLOCK_HEADER_SIZE, file) != BLOCK_HEADER_SIZE || get_u32(header) != BLOCK_MAGIC) return false;
+
+    const uint32_t flags = get_u32(header + 4);
+    if (flags & BLOCK_STORED) return fread(out, 1, entry->raw_size, file) == entry->raw_size;
+
+    unsigned char* packed = malloc(entry->packed_size);
+    if (!packed) return false;
+
+    const bool ok = fread(packed, 1, entry->packed_size, file) == entry->packed_size
+                    && log_decompress_block(packed, entry->packed_size, out, entry->raw_size) == entry->raw_size;
+    free(packed);
+    return ok;
+}
+
+bool log_decompress_file(FILE* in, FILE* out)
+{
+    DynamicArray_t index;
+    if (!log_compressed_read_index(in, &index))
+    {
+        free_dynamic_array(&index);
+        return false;
+    }
+
+    unsigned char* raw = malloc(LOG_COMPRESS_BLOCK_SIZE);
+    bool ok            = raw != NULL;
+
+    for (size_t i = 0; ok && i < index.count; i++)
+    {
+        const LogBlockIndex_t* entry = get_dynamic_array_element(&index, i);
+        ok = entry->raw_size <= LOG_COMPRESS_BLOCK_SIZE && log_compressed_read_block(in, entry, raw)
+             && fwrite(raw, 1, entry->raw_size, out) == entry->raw_size;
+    }
+
+    free(raw);
+    free_dynamic_array(&index);
+    return ok;
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+// Writer
+// ---------------------------------------------------------------------------------------------------------------
+
+LogCompressedFile_t* log_compressed_open(FILE* file)
+{
+    LogCompressedFile_t* writer = calloc(1, sizeof(LogCompressedFile_t));
+    if (!writer) return NULL;
+
+    writer->file   = file;
+    writer->raw    = malloc(LOG_COMPRESS_BLOCK_SIZE);
+    writer->packed = malloc(log_compress_bound(LOG_COMPRESS_BLOCK_SIZE));
+
+    // --- carry the blocks of earlier sessions over so the new index covers the whole file ---
+    uint64_t valid_end = 0;
+    if (!writer->raw || !writer->packed || !read_index(file, &writer->index, &valid_end))
+    {
+        free(writer->raw);
+        free(writer->packed);
+        free_dynamic_array(&writer->index);
+        free(writer);
+        return NULL;
+    }
+
+    if (writer->index.count > 0)
+    {
+        const LogBlockIndex_t* last = get_dynamic_array_element(&writer->index, writer->index.count - 1);
+        writer->raw_total = last->raw_offset + last->raw_size;
+    }
+
+    // --- trim a block torn by a crash so new blocks follow the last intact one (scans resync if this fails) ---
+    fseeko(file, 0, SEEK_END);
+    const off_t end = ftello(file);
+    if (end >= 0 && valid_end < (uint64_t)end && fflush(file) == 0)
+    {
+        if (ftruncate(fileno(file), (off_t)valid_end) == 0) fseeko(file, 0, SEEK_END);
+    }
+    return writer;
+}
+
+bool log_compressed_flush(LogCompressedFile_t* writer)
+{
+    if (writer->raw_len == 0) return fflush(writer->file) == 0;
+
+    size_t packed_size = log_compress_block(writer->raw, writer->raw_len, writer->packed,
+                                            log_compress_bound(LOG_COMPRESS_BLOCK_SIZE));
+    uint32_t flags = 0;
+    const unsigned char* payload = writer->packed;
+    if (packed_size == 0 || packed_size >= writer->raw_len)
+    {
+        flags       = BLOCK_STORED;
+        packed_size = writer->raw_len;
+        payload     = writer->raw;
+    }
+
+    fseeko(writer->file, 0, SEEK_END);
+    const off_t offset = ftello(writer->file);
+    if (offset < 0) return false;
+
+    unsigned char header[BLOCK_HEADER_SIZE];
+    put_u32(header, BLOCK_MAGIC);
+    put_u32(header + 4, flags);
+    put_u32(header + 8, (uint32_t)writer->raw_len);
+    put_u32(header + 12, (uint32_t)packed_size);
+
+    if (fwrite(header, 1, BLOCK_HEADER_SIZE, writer->file) != BLOCK_HEADER_SIZE) return false;
+    if (fwrite(payload, 1, packed_size, writer->file) != packed_size) return false;
+
+    const LogBlockIndex_t entry = {
+        .file_offset = (uint64_t)offset,
+        .raw_offset  = writer->raw_total,
+        .raw_size    = (uint32_t)writer->raw_len,
+        .packed_size = (uint32_t)packed_size
+    };
+    if (!push_dynamic_array(&writer->index, &entry)) return false;
+
+    writer->raw_total += writer->raw_len;
+    writer->raw_len = 0;
+    return fflush(writer->file) == 0;
+}
+
+bool log_compressed_write(LogCompressedFile_t* writer, const void* data, size_t size)
+{
+    const unsigned char* bytes = data;
+    while (size > 0)
+    {
+        size_t chunk = LOG_COMPRESS_BLOCK_SIZE - writer->raw_len;
+        if (chunk > size) chunk = size;
+
+        memcpy(writer->raw + writer->raw_len, bytes, chunk);
+        writer->raw_len += chunk;
+        bytes += chunk;
+        size -= chunk;
+
+        if (writer->raw_len == LOG_COMPRESS_BLOCK_SIZE && !log_compressed_flush(writer)) return false;
+    }
+    return true;
+}
+
+bool log_compressed_close(LogCompressedFile_t* writer)
+{
+    if (!writer) return false;
+
+    bool ok = log_compressed_flush(writer);
+
+    // --- append the index and footer ---
+    fseeko(writer->file, 0, SEEK_END);
+    const off_t index_offset = ftello(writer->file);
+    ok = ok && index_offset >= 0;
+
+    unsigned char buffer[INDEX_ENTRY_SIZE];
+    put_u32(buffer, INDEX_MAGIC);
+    put_u32(buffer + 4, (uint32_t)writer->index.count);
+    ok = ok && fwrite(buffer, 1, 8, writer->file) == 8;
+
+    for (size_t i = 0; ok && i < writer->index.count; i++)
+    {
+        const LogBlockIndex_t* entry = get_dynamic_array_element(&writer->index, i);
+        put_u64(buffer, entry->file_offset);
+        put_u64(buffer + 8, entry->raw_offset);
+        put_u32(buffer + 16, entry->raw_size);
+        put_u32(buffer + 20, entry->packed_size);
+        ok = fwrite(buffer, 1, INDEX_ENTRY_SIZE, writer->file) == INDEX_ENTRY_SIZE;
+    }
+
+    put_u64(buffer, (uint64_t)index_offset);
+    put_u32(buffer + 8, FOOTER_MAGIC);
+    put_u32(buffer + 12, 0);
+    ok = ok && fwrite(buffer, 1, FOOTER_SIZE, writer->file) == FOOTER_SIZE;
+    ok = fflush(writer->file) == 0 && ok;
+
+    free(writer->raw);
+    free(writer->packed);
+    free_dynamic_array(&writer->index);
+    free(writer);
+    return ok;
+}
@@ -1,10 +1,16 @@
 ﻿#include "jester/log/jester-log.h"
+#include "jester/log/jester-log-compress.h"
+#include "jester/log/jester-trace.h"
 #include "jester/datastructs/array/jester-dynamic-array.h"
+#include "jester/time/jester-time.h"
 
+#include <ctype.h>
+#include <pthread.h>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <unistd.h>
 
@@ -19,10 +25,28 @@ static const char* log_level_names[] =
 
 static const char* log_level_plain[] = {"[DEBUG]", "[INFO]", "[WARN]", "[ERROR]", "[FATAL]"};
 
-static LogQueue_t console_queue;
-static LogQueue_t file_queue;
+// Each logger owns its queues and a backend thread that drains them. Producers format the
+// record on their own thread and only hold the lock to copy it into the queues; when a queue
+// is full they wait for the backend, so one busy instance never blocks another.
+struct JesterLogger
+{
+    LogConfig_t cfg;
+    _Atomic int min_level;
+    LogQueue_t console_queue;
+    LogQueue_t file_queue;
+    pthread_mutex_t lock;
+    pthread_cond_t work_ready;
+    pthread_cond_t space_ready;
+    pthread_cond_t flushed;
+    pthread_t backend;
+    bool running;
+    bool stop;
+    uint64_t flush_requested;
+    uint64_t flush_completed;
+    bool trace_drain_requested;
+};
 
-static LogConfig_t default_cfg = {
+static const LogConfig_t default_cfg = {
     .color_enabled = true,
     .file_enabled = true,
     .console_enabled = true,
@@ -31,70 +55,331 @@ static LogConfig_t default_cfg = {
     .sink = NULL,
     .sink_user_data = NULL,
     .file = NULL,
-    .console_queue = &console_queue,
-    .file_queue = &file_queue
+    .console_queue = NULL,
+    .file_queue = NULL,
+    .compress_enabled = false,
+    .compressed_file = NULL
+};
+
+static JesterLogger_t default_logger = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .work_ready = PTHREAD_COND_INITIALIZER,
+    .space_ready = PTHREAD_COND_INITIALIZER,
+    .flushed = PTHREAD_COND_INITIALIZER
 };
 
-static LogConfig_t log_cfg;
+typedef struct LogModuleRule
+{
+    char prefix[LOG_MODULE_PREFIX_MAX];
+    size_t prefix_len;
+    LogLevel_t level;
+} LogModuleRule_t;
+
+static LogModuleRule_t module_rules[LOG_MAX_MODULE_RULES];
+static _Atomic int module_rule_count;
+static pthread_mutex_t module_rules_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// starts at 1 so a zero-initialized LogSite_t is always stale
+_Atomic uint32_t log_level_generation = 1;
 
-void set_cfg(const LogConfig_t* config)
+// must be called with module_rules_lock held
+static void bump_level_generation(void)
 {
-    log_cfg = *config;
+    uint32_t generation = (atomic_load_explicit(&log_level_generation, memory_order_relaxed) + 1) & 0xFFFFFFu;
+    if (generation == 0) generation = 1;
+    atomic_store_explicit(&log_level_generation, generation, memory_order_release);
 }
 
-bool log_init(const LogConfig_t* cfg)
+static bool queue_empty(const JesterLogger_t* logger)
+{
+    return logger->cfg.console_queue->count == 0 && logger->cfg.file_queue->count == 0;
+}
+
+static bool has_work(const JesterLogger_t* logger)
 {
-    log_cfg = cfg ? *cfg : default_cfg;
+    return logger->stop || !queue_empty(logger) || logger->flush_requested != logger->flush_completed ||
+           logger->trace_drain_requested;
+}
+
+static void write_record(const LogRecord_t* record, FILE* out, const char** level_names)
+{
+    fprintf(out, "%s %s %s:%d: %s\n", record->timestamp, level_names[record->level], record->file, record->line,
+            record->message);
+}
+
+static void write_record_compressed(const LogRecord_t* record, LogCompressedFile_t* out)
+{
+    char line[sizeof(((LogRecord_t*)0)->message) + 256];
+
+    int length = snprintf(line, sizeof(line), "%s %s %s:%d: %s\n", record->timestamp, log_level_plain[record->level],
+                          record->file, record->line, record->message);
+    if (length >= (int)sizeof(line)) length = (int)sizeof(line) - 1;
+    if (length > 0) log_compressed_write(out, line, (size_t)length);
+}
+
+// Writes up to LOG_BACKEND_BATCH records straight out of the queue slots. Only the backend
+// consumes, so the slots stay untouched while the lock is dropped; head is advanced afterwards.
+static void drain_batch(JesterLogger_t* logger, LogQueue_t* queue, const bool to_file)
+{
+    const int head = queue->head;
+    const int count = queue->count < LOG_BACKEND_BATCH ? queue->count : LOG_BACKEND_BATCH;
+    const char** level_names = logger->cfg.color_enabled ? log_level_names : log_level_plain;
+    pthread_mutex_unlock(&logger->lock);
+
+    for (int i = 0; i < count; i++)
+    {
+        const LogRecord_t* record = &queue->records[(head + i) % LOG_QUEUE_SIZE];
+        if (!to_file) write_record(record, stdout, level_names);
+        else if (logger->cfg.compressed_file) write_record_compressed(record, logger->cfg.compressed_file);
+        else if (logger->cfg.file) write_record(record, logger->cfg.file, log_level_plain);
+    }
+
+    pthread_mutex_lock(&logger->lock);
+    queue->head = (head + count) % LOG_QUEUE_SIZE;
+    queue->count -= count;
+    pthread_cond_broadcast(&logger->space_ready);
+}
+
+// seals the open compressed block and pushes everything to the OS; backend thread only.
+// The default instance also carries the trace stream, so a flush makes it current too.
+static void sync_outputs(JesterLogger_t* logger)
+{
+    if (logger == &default_logger) trace_drain_stream();
+    fflush(stdout);
+    if (logger->cfg.compressed_file) log_compressed_flush(logger->cfg.compressed_file);
+    else if (logger->cfg.file) fflush(logger->cfg.file);
+}
+
+static void* logger_backend_main(void* arg)
+{
+    JesterLogger_t* logger = arg;
+
+    pthread_mutex_lock(&logger->lock);
+    for (;;)
+    {
+        while (!has_work(logger)) pthread_cond_wait(&logger->work_ready, &logger->lock);
+
+        if (logger->cfg.console_queue->count > 0)
+        {
+            drain_batch(logger, logger->cfg.console_queue, false);
+        }
+        else if (logger->cfg.file_queue->count > 0)
+        {
+            drain_batch(logger, logger->cfg.file_queue, true);
+        }
+        else if (logger->trace_drain_requested)
+        {
+            logger->trace_drain_requested = false;
+            pthread_mutex_unlock(&logger->lock);
+            trace_drain_stream();
+            pthread_mutex_lock(&logger->lock);
+        }
+        else if (logger->flush_requested != logger->flush_completed)
+        {
+            // --- queues are empty here, so every record enqueued before the request is written ---
+            const uint64_t ticket = logger->flush_requested;
+            pthread_mutex_unlock(&logger->lock);
+            sync_outputs(logger);
+            pthread_mutex_lock(&logger->lock);
+            logger->flush_completed = ticket;
+            pthread_cond_broadcast(&logger->flushed);
+        }
+        else if (logger->stop)
+        {
+            break;
+        }
+    }
+    pthread_mutex_unlock(&logger->lock);
+
+    return NULL;
+}
+
+static bool open_log_file(LogConfig_t* cfg, const char* name_pattern)
+{
+    const time_t now = time(NULL);
+    struct tm tm;
+    localtime_r(&now, &tm);
+    char pattern[sizeof(cfg->file_name)];
+    snprintf(pattern, sizeof(pattern), "%s", name_pattern);
+    strftime(cfg->file_name, sizeof(cfg->file_name), pattern, &tm);
+
+    cfg->file = fopen(cfg->file_name, cfg->compress_enabled ? "a+b" : "a");
+    if (!cfg->file)
+    {
+        fprintf(stderr, "Could not open log file %s\n", cfg->file_name);
+        return false;
+    }
+
+    if (cfg->compress_enabled)
+    {
+        cfg->compressed_file = log_compressed_open(cfg->file);
+        if (!cfg->compressed_file)
+        {
+            fprintf(stderr, "Could not read compressed log file %s\n", cfg->file_name);
+            fclose(cfg->file);
+            cfg->file = NULL;
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool logger_start(JesterLogger_t* logger, const LogConfig_t* cfg, const char* name_pattern)
+{
+    logger->cfg = cfg ? *cfg : default_cfg;
+    logger->cfg.file = NULL;
+    logger->cfg.compressed_file = NULL;
+    if (!logger->cfg.console_queue) logger->cfg.console_queue = &logger->console_queue;
+    if (!logger->cfg.file_queue) logger->cfg.file_queue = &logger->file_queue;
+    memset(logger->cfg.console_queue, 0, sizeof(LogQueue_t));
+    memset(logger->cfg.file_queue, 0, sizeof(LogQueue_t));
+    atomic_store(&logger->min_level, logger->cfg.min_log_level);
 
 #ifdef _WIN32
     // Windows build
-     log_cfg.color_enabled = false;
+     logger->cfg.color_enabled = false;
 #else
     // Unix / macOS / WSL
     if (!isatty(fileno(stdout)) || getenv("TERM") == NULL)
-        log_cfg.color_enabled = false;
+        logger->cfg.color_enabled = false;
     else
-        log_cfg.color_enabled = true;
+        logger->cfg.color_enabled = true;
 #endif
 
-    const time_t now = time(NULL);
-    const struct tm tm = *localtime(&now);
-    strftime(log_cfg.file_name, sizeof(log_cfg.file_name), "logger_%m-%d-%Y.txt", &tm);
+    if (logger->cfg.file_enabled && !open_log_file(&logger->cfg, name_pattern)) return false;
+
+    logger->stop = false;
+    logger->flush_requested = 0;
+    logger->flush_completed = 0;
+    logger->running = pthread_create(&logger->backend, NULL, logger_backend_main, logger) == 0;
+    return logger->running;
+}
 
-    if (log_cfg.file_enabled)
+static void logger_stop(JesterLogger_t* logger)
+{
+    if (logger->running)
     {
-        log_cfg.file = fopen(log_cfg.file_name, "a");
-        if (!log_cfg.file)
-        {
-            fprintf(stderr, "Could not open log file %s\n", log_cfg.file_name);
-            return false;
-        }
+        pthread_mutex_lock(&logger->lock);
+        logger->stop = true;
+        pthread_cond_signal(&logger->work_ready);
+        pthread_mutex_unlock(&logger->lock);
+
+        pthread_join(logger->backend, NULL);
+        logger->running = false;
+    }
+
+    sync_outputs(logger);
+    if (logger->cfg.compressed_file)
+    {
+        log_compressed_close(logger->cfg.compressed_file);
+        logger->cfg.compressed_file = NULL;
+    }
+    if (logger->cfg.file)
+    {
+        fclose(logger->cfg.file);
+        logger->cfg.file = NULL;
     }
-    return true;
 }
 
+JesterLogger_t* logger_create(const LogConfig_t* cfg)
+{
+    JesterLogger_t* logger = calloc(1, sizeof(JesterLogger_t));
+    if (!logger) return NULL;
 
-void log_msg(const LogLevel_t level, const char *file, const int line, const char *format, ...)
+    pthread_mutex_init(&logger->lock, NULL);
+    pthread_cond_init(&logger->work_ready, NULL);
+    pthread_cond_init(&logger->space_ready, NULL);
+    pthread_cond_init(&logger->flushed, NULL);
+
+    // --- the configured file name may carry strftime() patterns, e.g. "audit_%m-%d-%Y.txt" ---
+    const char* name_pattern = cfg && cfg->file_name[0] ? cfg->file_name : "logger_%m-%d-%Y.txt";
+    if (!logger_start(logger, cfg, name_pattern))
+    {
+        logger_destroy(logger);
+        return NULL;
+    }
+    return logger;
+}
+
+void logger_destroy(JesterLogger_t* logger)
 {
-    if (level < log_cfg.min_log_level) return;
+    if (!logger || logger == &default_logger) return;
+
+    logger_stop(logger);
+    pthread_mutex_destroy(&logger->lock);
+    pthread_cond_destroy(&logger->work_ready);
+    pthread_cond_destroy(&logger->space_ready);
+    pthread_cond_destroy(&logger->flushed);
+    free(logger);
+}
 
-    const time_t now = time(NULL);
-    const struct tm tm = *localtime(&now);
-    char t_buffer[32];
-    strftime(t_buffer, sizeof(t_buffer), "%m-%d-%Y %H:%M:%S", &tm);
+JesterLogger_t* log_default_logger(void)
+{
+    return &default_logger;
+}
 
-    va_list args;
-    va_start(args, format);
-    va_list args_copy;
-    va_copy(args_copy, args);
-    va_list args_copy2;
-    va_copy(args_copy2, args);
+bool log_init(const LogConfig_t* cfg)
+{
+    if (default_logger.running) logger_stop(&default_logger);
+
+    const bool compress = cfg ? cfg->compress_enabled : default_cfg.compress_enabled;
+    const bool ok = logger_start(&default_logger, cfg, compress ? "logger_%m-%d-%Y.jlz" : "logger_%m-%d-%Y.txt");
+
+    pthread_mutex_lock(&module_rules_lock);
+    bump_level_generation();
+    pthread_mutex_unlock(&module_rules_lock);
+
+    return ok;
+}
+
+bool enqueue(const LogRecord_t *record, LogQueue_t *queue)
+{
+    if (queue->count == LOG_QUEUE_SIZE) return false;
+
+    queue->records[queue->tail] = *record;
+    queue->tail = (queue->tail + 1) % LOG_QUEUE_SIZE;
+    queue->count++;
+    return true;
+}
+
+// localtime_r/strftime only run when the second changes; the millisecond part is appended per record
+static void format_timestamp(char* buffer, const size_t size)
+{
+    static _Thread_local time_t cached_second = (time_t)-1;
+    static _Thread_local char cached_text[24];
+
+    const uint64_t wall_ns = jester_wall_ns();
+    const time_t second = (time_t)(wall_ns / 1000000000ull);
+    if (second != cached_second)
+    {
+        struct tm tm;
+        localtime_r(&second, &tm);
+        strftime(cached_text, sizeof(cached_text), "%m-%d-%Y %H:%M:%S", &tm);
+        cached_second = second;
+    }
+
+    snprintf(buffer, size, "%s.%03u", cached_text, (unsigned)((wall_ns / 1000000ull) % 1000ull));
+}
+
+static void enqueue_blocking(JesterLogger_t* logger, const LogRecord_t* record, LogQueue_t* queue)
+{
+    while (!enqueue(record, queue))
+    {
+        pthread_cond_signal(&logger->work_ready);
+        pthread_cond_wait(&logger->space_ready, &logger->lock);
+    }
+}
+
+void logger_vlog(JesterLogger_t* logger, const LogLevel_t level, const char* file, const int line,
+                 const char* format, va_list args)
+{
+    if (!logger->running) return;
 
     LogRecord_t record;
 
     record.level = level;
 
-    strcpy(record.timestamp, t_buffer); // record.timestamp = the time buffer
+    format_timestamp(record.timestamp, sizeof(record.timestamp));
 
     record.file = file;
 
@@ -102,73 +387,265 @@ void log_msg(const LogLevel_t level, const char *file, const int line, const cha
 
     vsnprintf(record.message, sizeof(record.message), format, args);
 
-    if (config.console_enabled)
+    pthread_mutex_lock(&logger->lock);
+    if (logger->cfg.console_enabled)
     {
-        enqueue(record, &config.console_queue);
+        enqueue_blocking(logger, &record, logger->cfg.console_queue);
     }
-    if (config.file_enabled)
+    if (logger->cfg.file_enabled && logger->cfg.file)
     {
-        enqueue(record, &config.file_queue);
+        enqueue_blocking(logger, &record, logger->cfg.file_queue);
     }
+    const LogSinkFn sink = logger->cfg.sink;
+    void* sink_user_data = logger->cfg.sink_user_data;
+    pthread_cond_signal(&logger->work_ready);
+    pthread_mutex_unlock(&logger->lock);
 
-    if (log_cfg.sink)
+    if (sink)
     {
-        char message_buffer[512];
-        vsnprintf(message_buffer, sizeof(message_buffer), format, args_copy2);
-        log_cfg.sink(level, file, line, message_buffer, log_cfg.sink_user_data);
+        sink(level, file, line, record.message, sink_user_data);
     }
+}
 
+void logger_log(JesterLogger_t* logger, const LogLevel_t level, const char* file, const int line,
+                const char* format, ...)
+{
+    if ((int)level < atomic_load_explicit(&logger->min_level, memory_order_relaxed)) return;
+
+    va_list args;
+    va_start(args, format);
+    logger_vlog(logger, level, file, line, format, args);
     va_end(args);
-    va_end(args_copy);
-    va_end(args_copy2);
 }
 
-void enqueue(const LogRecord_t *record, const LogQueue_t *queue)
+void log_msg(const LogLevel_t level, const char *file, const int line, const char *format, ...)
 {
-    if (queue->count == 128) log_flush();
+    if (level < log_level_for_file(file)) return;
 
-    else
-    {
+    va_list args;
+    va_start(args, format);
+    logger_vlog(&default_logger, level, file, line, format, args);
+    va_end(args);
+}
 
-    }
+// unfiltered entry point used by the LOG_* macros once their call site is enabled
+void log_write(const LogLevel_t level, const char* file, const int line, const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    logger_vlog(&default_logger, level, file, line, format, args);
+    va_end(args);
+}
+
+void logger_flush(JesterLogger_t* logger)
+{
+    if (!logger->running) return;
+
+    pthread_mutex_lock(&logger->lock);
+    const uint64_t ticket = ++logger->flush_requested;
+    pthread_cond_signal(&logger->work_ready);
+    while (logger->flush_completed < ticket && logger->running)
+        pthread_cond_wait(&logger->flushed, &logger->lock);
+    pthread_mutex_unlock(&logger->lock);
+}
+
+void log_request_trace_drain(void)
+{
+    pthread_mutex_lock(&default_logger.lock);
+    default_logger.trace_drain_requested = true;
+    pthread_cond_signal(&default_logger.work_ready);
+    pthread_mutex_unlock(&default_logger.lock);
 }
 
 void log_flush()
 {
-    if (log_cfg.file)
-    {
-        fflush(log_cfg.file);
-    }
+    logger_flush(&default_logger);
 }
 
 void log_shutdown()
 {
-    if (log_cfg.file)
-    {
-        log_flush();
-        fclose(log_cfg.file);
-        log_cfg.file = NULL;
-    }
+    logger_stop(&default_logger);
+}
+
+void logger_set_sink(JesterLogger_t* logger, LogSinkFn sink, void* user_data)
+{
+    pthread_mutex_lock(&logger->lock);
+    logger->cfg.sink = sink;
+    logger->cfg.sink_user_data = user_data;
+    pthread_mutex_unlock(&logger->lock);
 }
 
 void log_set_sink(LogSinkFn sink, void* user_data)
 {
-    log_cfg.sink = sink;
-    log_cfg.sink_user_data = user_data;
+    logger_set_sink(&default_logger, sink, user_data);
+}
+
+void logger_set_min_level(JesterLogger_t* logger, const LogLevel_t level)
+{
+    if (logger == &default_logger)
+    {
+        set_min_log_level(level);
+        return;
+    }
+    atomic_store(&logger->min_level, level);
 }
 
 void set_min_log_level(const LogLevel_t level)
 {
-    log_cfg.min_log_level = level;
+    pthread_mutex_lock(&module_rules_lock);
+    atomic_store(&default_logger.min_level, level);
+    bump_level_generation();
+    pthread_mutex_unlock(&module_rules_lock);
 }
 
 void toggle_color(const bool enabled)
 {
-    log_cfg.color_enabled = enabled;
+    pthread_mutex_lock(&default_logger.lock);
+    default_logger.cfg.color_enabled = enabled;
+    pthread_mutex_unlock(&default_logger.lock);
 }
 
 void toggle_file(const bool enabled)
 {
-    log_cfg.file_enabled = enabled;
+    pthread_mutex_lock(&default_logger.lock);
+    default_logger.cfg.file_enabled = enabled;
+    pthread_mutex_unlock(&default_logger.lock);
+}
+
+static bool parse_level(const char* name, const size_t len, LogLevel_t* level)
+{
+    static const struct { const char* name; LogLevel_t level; } levels[] = {
+        {"DEBUG", DEBUG}, {"INFO", INFO}, {"WARN", WARNING}, {"WARNING", WARNING}, {"ERROR", ERROR}, {"FATAL", FATAL}
+    };
+
+    for (size_t i = 0; i < sizeof(levels) / sizeof(levels[0]); i++)
+    {
+        if (strlen(levels[i].name) == len && strncasecmp(levels[i].name, name, len) == 0)
+        {
+            *level = levels[i].level;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool log_set_module_levels(const char* spec)
+{
+    LogModuleRule_t rules[LOG_MAX_MODULE_RULES];
+    int rule_count = 0;
+    bool has_default = false;
+    LogLevel_t default_level = DEBUG;
+
+    // --- parse into a scratch table so a bad spec leaves the current rules untouched ---
+    const char* p = spec;
+    while (p && *p)
+    {
+        const char* end = strchr(p, ',');
+        if (!end) end = p + strlen(p);
+
+        const char* key = p;
+        const char* key_end = end;
+        const char* value = p;
+        const char* eq = memchr(p, '=', (size_t)(end - p));
+        if (eq)
+        {
+            key_end = eq;
+            value = eq + 1;
+        }
+        else
+        {
+            key_end = key; // bare level
+        }
+
+        while (key < key_end && isspace((unsigned char)*key)) key++;
+        while (key_end > key && isspace((unsigned char)key_end[-1])) key_end--;
+        const char* value_end = end;
+        while (value < value_end && isspace((unsigned char)*value)) value++;
+        while (value_end > value && isspace((unsigned char)value_end[-1])) value_end--;
+
+        if (value != value_end)
+        {
+            LogLevel_t level;
+            if (!parse_level(value, (size_t)(value_end - value), &level)) return false;
+
+            const size_t key_len = (size_t)(key_end - key);
+            if (key_len == 0 || (key_len == 1 && *key == '*'))
+            {
+                has_default = true;
+                default_level = level;
+            }
+            else
+            {
+                if (rule_count == LOG_MAX_MODULE_RULES || key_len >= LOG_MODULE_PREFIX_MAX) return false;
+                memcpy(rules[rule_count].prefix, key, key_len);
+                rules[rule_count].prefix[key_len] = '\0';
+                rules[rule_count].prefix_len = key_len;
+                rules[rule_count].level = level;
+                rule_count++;
+            }
+        }
+
+        p = *end ? end + 1 : end;
+    }
+
+    // --- publish and invalidate every cached call site ---
+    pthread_mutex_lock(&module_rules_lock);
+    memcpy(module_rules, rules, sizeof(rules[0]) * (size_t)rule_count);
+    atomic_store(&module_rule_count, rule_count);
+    if (has_default) atomic_store(&default_logger.min_level, default_level);
+    bump_level_generation();
+    pthread_mutex_unlock(&module_rules_lock);
+
+    return true;
+}
+
+void log_clear_module_levels(void)
+{
+    pthread_mutex_lock(&module_rules_lock);
+    atomic_store(&module_rule_count, 0);
+    bump_level_generation();
+    pthread_mutex_unlock(&module_rules_lock);
+}
+
+static bool prefix_matches(const char* file, const LogModuleRule_t* rule)
+{
+    for (const char* p = file; *p; p++)
+    {
+        if (p != file && p[-1] != '/' && p[-1] != '\\') continue;
+        if (strncmp(p, rule->prefix, rule->prefix_len) == 0) return true;
+    }
+    return false;
+}
+
+LogLevel_t log_level_for_file(const char* file)
+{
+    const LogLevel_t fallback = (LogLevel_t)atomic_load_explicit(&default_logger.min_level, memory_order_relaxed);
+    if (atomic_load_explicit(&module_rule_count, memory_order_relaxed) == 0) return fallback;
+
+    pthread_mutex_lock(&module_rules_lock);
+    LogLevel_t level = (LogLevel_t)atomic_load_explicit(&default_logger.min_level, memory_order_relaxed);
+    size_t best_len = 0;
+    const int rule_count = atomic_load_explicit(&module_rule_count, memory_order_relaxed);
+    for (int i = 0; i < rule_count; i++)
+    {
+        const LogModuleRule_t* rule = &module_rules[i];
+        if (rule->prefix_len > best_len && prefix_matches(file, rule))
+        {
+            best_len = rule->prefix_len;
+            level = rule->level;
+        }
+    }
+    pthread_mutex_unlock(&module_rules_lock);
+
+    return level;
 }
 
+// slow path of log_site_enabled(): runs once per call site per configuration change
+uint32_t log_resolve_site(LogSite_t* site, const char* file)
+{
+    const uint32_t generation = atomic_load_explicit(&log_level_generation, memory_order_acquire);
+    const LogLevel_t level = log_level_for_file(file);
+    const uint32_t state = (generation << 8) | (uint32_t)level;
+    atomic_store_explicit(&site->state, state, memory_order_relaxed);
+    return state;
+}
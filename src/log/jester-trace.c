@@ -0,0 +1,307 @@
+﻿#include "jester/log/jester-trace.h"
+#include "jester/log/jester-log.h"
+#include "jester/time/jester-time.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+// One buffer per thread, written only by its owner. The owner publishes each event
+// by bumping count (release), so the exporter can read a live buffer up to count
+// without locking. A full buffer is never written again and is handed off to the
+// global list exactly like a full LogQueue_t is handed to log_flush(). When its
+// thread exits, a partial buffer is retired the same way: freed as soon as every
+// event in it has been exported.
+typedef struct TraceBuffer
+{
+    TraceEvent_t events[TRACE_BUFFER_EVENTS];
+    _Atomic int count;
+    int exported;
+    bool retired;
+    struct TraceBuffer* next;
+} TraceBuffer_t;
+
+static _Atomic bool trace_enabled;
+static pthread_mutex_t trace_lock = PTHREAD_MUTEX_INITIALIZER;
+static TraceBuffer_t* trace_buffers;
+static size_t trace_buffer_total;
+static _Atomic uint32_t trace_epoch;
+static pthread_once_t trace_key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t trace_key;
+static bool trace_key_ready;
+
+// the file trace_open_stream() opened; the default logger's backend drains into it
+static FILE* trace_stream;
+static bool trace_stream_first;
+static _Atomic bool trace_streaming;
+#ifndef __linux__
+static _Atomic uint32_t next_thread_id = 1;
+#endif
+
+static _Thread_local TraceBuffer_t* thread_buffer;
+static _Thread_local uint32_t thread_buffer_epoch;
+static _Thread_local uint32_t thread_id;
+
+static uint32_t current_thread_id(void)
+{
+    if (thread_id == 0)
+    {
+#ifdef __linux__
+        thread_id = (uint32_t)syscall(SYS_gettid);
+#else
+        thread_id = atomic_fetch_add(&next_thread_id, 1);
+#endif
+    }
+    return thread_id;
+}
+
+// must be called with trace_lock held
+static void unlink_buffer(TraceBuffer_t** link)
+{
+    TraceBuffer_t* buffer = *link;
+    *link = buffer->next;
+    trace_buffer_total--;
+    free(buffer);
+}
+
+// --- pthread key destructor: runs on the exiting thread for its partial buffer ---
+static void release_thread_buffer(void* arg)
+{
+    TraceBuffer_t* buffer = arg;
+    bool pending = false;
+
+    pthread_mutex_lock(&trace_lock);
+
+    // --- a buffer from an older epoch was already freed by trace_shutdown() ---
+    if (thread_buffer_epoch == atomic_load_explicit(&trace_epoch, memory_order_relaxed))
+    {
+        buffer->retired = true;
+        pending = buffer->exported != atomic_load_explicit(&buffer->count, memory_order_relaxed);
+
+        TraceBuffer_t** link = &trace_buffers;
+        while (!pending && *link != buffer) link = &(*link)->next;
+        if (!pending) unlink_buffer(link);
+    }
+    pthread_mutex_unlock(&trace_lock);
+
+    thread_buffer = NULL;
+    if (pending && atomic_load_explicit(&trace_streaming, memory_order_relaxed)) log_request_trace_drain();
+}
+
+static void create_trace_key(void)
+{
+    trace_key_ready = pthread_key_create(&trace_key, release_thread_buffer) == 0;
+}
+
+static TraceBuffer_t* acquire_thread_buffer(void)
+{
+    pthread_once(&trace_key_once, create_trace_key);
+
+    TraceBuffer_t* buffer = calloc(1, sizeof(TraceBuffer_t));
+    if (!buffer) return NULL;
+
+    pthread_mutex_lock(&trace_lock);
+    buffer->next = trace_buffers;
+    trace_buffers = buffer;
+    trace_buffer_total++;
+    thread_buffer_epoch = atomic_load_explicit(&trace_epoch, memory_order_relaxed);
+    pthread_mutex_unlock(&trace_lock);
+
+    // --- without the key the buffer is only released by trace_shutdown(), as before ---
+    if (trace_key_ready) pthread_setspecific(trace_key, buffer);
+    thread_buffer = buffer;
+    return buffer;
+}
+
+static void record_event(const char* name, const char phase)
+{
+    if (!atomic_load_explicit(&trace_enabled, memory_order_relaxed)) return;
+
+    // --- buffers released by trace_shutdown() belong to an older epoch ---
+    TraceBuffer_t* buffer = thread_buffer;
+    if (!buffer || thread_buffer_epoch != atomic_load_explicit(&trace_epoch, memory_order_relaxed))
+    {
+        buffer = acquire_thread_buffer();
+        if (!buffer) return;
+    }
+    const int count = atomic_load_explicit(&buffer->count, memory_order_relaxed);
+
+    TraceEvent_t* event = &buffer->events[count];
+    event->name = name;
+    event->timestamp_ns = jester_now_ns();
+    event->thread_id = current_thread_id();
+    event->phase = phase;
+    atomic_store_explicit(&buffer->count, count + 1, memory_order_release);
+
+    // --- a full buffer now belongs to the exporter, never touch it again ---
+    if (count + 1 == TRACE_BUFFER_EVENTS)
+    {
+        thread_buffer = NULL;
+        if (trace_key_ready) pthread_setspecific(trace_key, NULL);
+        if (atomic_load_explicit(&trace_streaming, memory_order_relaxed)) log_request_trace_drain();
+    }
+}
+
+void trace_enable(const bool enabled)
+{
+    atomic_store(&trace_enabled, enabled);
+}
+
+bool trace_is_enabled(void)
+{
+    return atomic_load(&trace_enabled);
+}
+
+void trace_begin(const char* name)
+{
+    record_event(name, 'B');
+}
+
+void trace_end(const char* name)
+{
+    record_event(name, 'E');
+}
+
+static void write_json_string(FILE* out, const char* s)
+{
+    fputc('"', out);
+    for (; *s; s++)
+    {
+        const unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') fprintf(out, "\\%c", c);
+        else if (c < 0x20) fprintf(out, "\\u%04x", c);
+        else fputc(c, out);
+    }
+    fputc('"', out);
+}
+
+// Writes every event recorded since the previous export and releases the buffers that
+// will never be written again. Must be called with trace_lock held.
+static void write_pending_events(FILE* out, bool* first)
+{
+    const int pid = (int)getpid();
+
+    TraceBuffer_t** link = &trace_buffers;
+    while (*link)
+    {
+        TraceBuffer_t* buffer = *link;
+        const int count = atomic_load_explicit(&buffer->count, memory_order_acquire);
+
+        for (int i = buffer->exported; i < count; i++)
+        {
+            const TraceEvent_t* event = &buffer->events[i];
+            fputs(*first ? "" : ",\n", out);
+            fputs("{\"name\":", out);
+            write_json_string(out, event->name);
+            fprintf(out, ",\"ph\":\"%c\",\"ts\":%llu.%03u,\"pid\":%d,\"tid\":%u}", event->phase,
+                    (unsigned long long)(event->timestamp_ns / 1000), (unsigned)(event->timestamp_ns % 1000), pid,
+                    event->thread_id);
+            *first = false;
+        }
+        buffer->exported = count;
+
+        // --- full buffers and those of exited threads are never written again, release them ---
+        if (count == TRACE_BUFFER_EVENTS || buffer->retired) unlink_buffer(link);
+        else link = &buffer->next;
+    }
+}
+
+bool trace_write_json(FILE* out)
+{
+    if (!out) return false;
+
+    bool first = true;
+    fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", out);
+
+    pthread_mutex_lock(&trace_lock);
+    write_pending_events(out, &first);
+    pthread_mutex_unlock(&trace_lock);
+
+    fputs("\n]}\n", out);
+    return ferror(out) == 0;
+}
+
+bool trace_export_json(const char* file_name)
+{
+    FILE* out = fopen(file_name, "w");
+    if (!out)
+    {
+        fprintf(stderr, "Could not open trace file %s\n", file_name);
+        return false;
+    }
+
+    const bool ok = trace_write_json(out);
+    return fclose(out) == 0 && ok;
+}
+
+// must be called with trace_lock held
+static bool close_stream(void)
+{
+    if (!trace_stream) return true;
+
+    write_pending_events(trace_stream, &trace_stream_first);
+    fputs("\n]}\n", trace_stream);
+    const bool ok = ferror(trace_stream) == 0;
+
+    atomic_store(&trace_streaming, false);
+    const bool closed = fclose(trace_stream) == 0;
+    trace_stream = NULL;
+    return closed && ok;
+}
+
+bool trace_open_stream(const char* file_name)
+{
+    FILE* out = fopen(file_name, "w");
+    if (!out)
+    {
+        fprintf(stderr, "Could not open trace file %s\n", file_name);
+        return false;
+    }
+    fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", out);
+
+    pthread_mutex_lock(&trace_lock);
+    close_stream();
+    trace_stream = out;
+    trace_stream_first = true;
+    atomic_store(&trace_streaming, true);
+    pthread_mutex_unlock(&trace_lock);
+    return true;
+}
+
+void trace_drain_stream(void)
+{
+    if (!atomic_load_explicit(&trace_streaming, memory_order_relaxed)) return;
+
+    pthread_mutex_lock(&trace_lock);
+    if (trace_stream)
+    {
+        write_pending_events(trace_stream, &trace_stream_first);
+        fflush(trace_stream);
+    }
+    pthread_mutex_unlock(&trace_lock);
+}
+
+size_t trace_buffer_count(void)
+{
+    pthread_mutex_lock(&trace_lock);
+    const size_t count = trace_buffer_total;
+    pthread_mutex_unlock(&trace_lock);
+    return count;
+}
+
+void trace_shutdown(void)
+{
+    atomic_store(&trace_enabled, false);
+
+    pthread_mutex_lock(&trace_lock);
+    close_stream();
+    atomic_fetch_add(&trace_epoch, 1);
+    while (trace_buffers) unlink_buffer(&trace_buffers);
+    pthread_mutex_unlock(&trace_lock);
+}
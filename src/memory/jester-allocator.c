@@ -0,0 +1,49 @@
+﻿/**
+ * @file      jester-allocator.c
+ * @brief     Default heap allocator for the Jester stdlib.
+ *
+ * @details   Thin adapter from the JesterAllocator_t interface to
+ *            malloc/realloc/free. The size arguments are not needed by the
+ *            C heap and are ignored.
+ *
+ * @copyright GPL-3.0
+ * @author    Case Presley
+ * @date      10-16-2026
+ */
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include "jester/memory/jester-allocator.h"                // |
+#include <stdlib.h>                                        // |
+//------------------------------------------------------------┙
+
+static void* heap_allocate(void* context, const size_t size)
+{
+    (void)context;
+    return malloc(size);
+}
+
+static void* heap_reallocate(void* context, void* ptr, const size_t old_size, const size_t new_size)
+{
+    (void)context;
+    (void)old_size;
+    return realloc(ptr, new_size);
+}
+
+static void heap_deallocate(void* context, void* ptr, const size_t size)
+{
+    (void)context;
+    (void)size;
+    free(ptr);
+}
+
+static const JesterAllocator_t heap_allocator = {
+    .allocate   = heap_allocate,
+    .reallocate = heap_reallocate,
+    .deallocate = heap_deallocate,
+    .context    = NULL
+};
+
+const JesterAllocator_t* jester_heap_allocator(void)
+{
+    return &heap_allocator;
+}
@@ -0,0 +1,259 @@
+﻿/**
+ * @file      jester-arena.c
+ * @brief     Implementation of the arena (bump) allocator for the Jester stdlib.
+ *
+ * @details   Chunks form a doubly linked chain. Allocation bumps the current
+ *            chunk; when it is full the arena moves on to the next retained
+ *            chunk (left over from before a reset or rewind) or links in a new
+ *            one. Resetting or rewinding only moves the current position, so
+ *            both run in O(1) and the chunks are reused instead of freed.
+ *
+ * @copyright GPL-3.0
+ * @author    Case Presley
+ * @date      10-16-2026
+ */
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include "jester/memory/jester-arena.h"                    // |
+#include <stdint.h>                                        // |
+#include <string.h>                                        // |
+//------------------------------------------------------------┙
+
+typedef struct ArenaChunk
+{
+    struct ArenaChunk* prev;
+    struct ArenaChunk* next;
+    size_t capacity;  // usable bytes after the header
+    size_t used;
+    bool owned;       // false for the caller-owned buffer of a fixed arena
+} ArenaChunk_t;
+
+#define CHUNK_HEADER_SIZE \
+    ((sizeof(ArenaChunk_t) + JESTER_ARENA_DEFAULT_ALIGNMENT - 1) & ~(size_t)(JESTER_ARENA_DEFAULT_ALIGNMENT - 1))
+
+static unsigned char* chunk_data(ArenaChunk_t* chunk)
+{
+    return (unsigned char*)chunk + CHUNK_HEADER_SIZE;
+}
+
+// --- offset within the chunk at which an aligned block of size bytes fits, or SIZE_MAX ---
+static size_t fit_in_chunk(ArenaChunk_t* chunk, const size_t size, const size_t alignment)
+{
+    const uintptr_t base    = (uintptr_t)chunk_data(chunk);
+    const uintptr_t aligned = (base + chunk->used + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    const size_t offset     = (size_t)(aligned - base);
+
+    if (offset > chunk->capacity || size > chunk->capacity - offset) return SIZE_MAX;
+    return offset;
+}
+
+static void* arena_allocator_allocate(void* context, size_t size);
+static void* arena_allocator_reallocate(void* context, void* ptr, size_t old_size, size_t new_size);
+static void arena_allocator_deallocate(void* context, void* ptr, size_t size);
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+Arena_t create_arena_with_allocator(const size_t chunk_size, const JesterAllocator_t* backing)
+{
+    Arena_t arena    = {};  // initialize to defaults
+    arena.chunk_size = chunk_size ? chunk_size : JESTER_ARENA_DEFAULT_CHUNK_SIZE;
+    arena.backing    = backing;
+
+    arena.allocator.allocate   = arena_allocator_allocate;
+    arena.allocator.reallocate = arena_allocator_reallocate;
+    arena.allocator.deallocate = arena_allocator_deallocate;
+
+    return arena;
+}
+
+Arena_t create_arena(const size_t chunk_size)
+{
+    return create_arena_with_allocator(chunk_size, NULL);
+}
+
+Arena_t create_arena_from_buffer(void* buffer, const size_t size)
+{
+    Arena_t arena = create_arena_with_allocator(size, NULL);
+    arena.fixed   = true;
+
+    // --- place the chunk header at the first aligned address in the buffer ---
+    const uintptr_t start   = (uintptr_t)buffer;
+    const uintptr_t aligned = (start + JESTER_ARENA_DEFAULT_ALIGNMENT - 1)
+                              & ~(uintptr_t)(JESTER_ARENA_DEFAULT_ALIGNMENT - 1);
+    const size_t padding    = (size_t)(aligned - start);
+    if (buffer == NULL || size < padding + CHUNK_HEADER_SIZE) return arena;  // too small, every allocation fails
+
+    ArenaChunk_t* chunk = (ArenaChunk_t*)aligned;
+    chunk->prev         = NULL;
+    chunk->next         = NULL;
+    chunk->capacity     = size - padding - CHUNK_HEADER_SIZE;
+    chunk->used         = 0;
+    chunk->owned        = false;
+
+    arena.first   = chunk;
+    arena.current = chunk;
+    return arena;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return NULL on failure                     |
+//-----------------------------------------------------┙
+void* allocate_arena_aligned(Arena_t* arena, const size_t size, const size_t alignment)
+{
+    // --- validate alignment (must be a power of two) ---
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) return NULL;
+
+    // --- bump the current chunk, then any retained chunks after it ---
+    ArenaChunk_t* chunk = arena->current;
+    ArenaChunk_t* last  = chunk;
+    while (chunk)
+    {
+        const size_t offset = fit_in_chunk(chunk, size, alignment);
+        if (offset != SIZE_MAX)
+        {
+            chunk->used    = offset + size;
+            arena->current = chunk;
+            return chunk_data(chunk) + offset;
+        }
+
+        last  = chunk;
+        chunk = chunk->next;
+        if (chunk) chunk->used = 0;  // retained chunks past the current one are free
+    }
+
+    if (arena->fixed) return NULL;  // caller-owned buffer exhausted
+
+    // --- link a new chunk after the last one visited ---
+    const size_t slack    = alignment > JESTER_ARENA_DEFAULT_ALIGNMENT ? alignment : 0;
+    const size_t capacity = size + slack > arena->chunk_size ? size + slack : arena->chunk_size;
+    if (capacity < size) return NULL;  // overflow
+
+    ArenaChunk_t* fresh = jester_allocate(arena->backing, CHUNK_HEADER_SIZE + capacity);
+    if (fresh == NULL) return NULL;
+
+    fresh->capacity = capacity;
+    fresh->used     = 0;
+    fresh->owned    = true;
+    fresh->prev     = last;
+    fresh->next     = last ? last->next : NULL;
+    if (fresh->next) fresh->next->prev = fresh;
+    if (last) last->next = fresh;
+    else arena->first = fresh;
+
+    const size_t offset = fit_in_chunk(fresh, size, alignment);
+    fresh->used         = offset + size;
+    arena->current      = fresh;
+    return chunk_data(fresh) + offset;
+}
+
+void* allocate_arena(Arena_t* arena, const size_t size)
+{
+    return allocate_arena_aligned(arena, size, JESTER_ARENA_DEFAULT_ALIGNMENT);
+}
+
+ArenaMark_t mark_arena(const Arena_t* arena)
+{
+    const ArenaMark_t mark = {arena->current, arena->current ? arena->current->used : 0};
+    return mark;
+}
+
+void rewind_arena(Arena_t* arena, const ArenaMark_t mark)
+{
+    // --- a mark taken before the first chunk existed rewinds to empty ---
+    if (mark.chunk == NULL)
+    {
+        reset_arena(arena);
+        return;
+    }
+
+    arena->current       = mark.chunk;
+    arena->current->used = mark.used;
+}
+
+void reset_arena(Arena_t* arena)
+{
+    arena->current = arena->first;
+    if (arena->current) arena->current->used = 0;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool free_arena(Arena_t* arena)
+{
+    bool freed          = false;
+    ArenaChunk_t* chunk = arena->first;
+
+    // --- release every chunk the arena allocated itself ---
+    while (chunk)
+    {
+        ArenaChunk_t* next = chunk->next;
+        if (chunk->owned)
+        {
+            jester_deallocate(arena->backing, chunk, CHUNK_HEADER_SIZE + chunk->capacity);
+            freed = true;
+        }
+        chunk = next;
+    }
+
+    arena->first   = NULL;
+    arena->current = NULL;
+    return freed;
+}
+
+const JesterAllocator_t* get_arena_allocator(Arena_t* arena)
+{
+    arena->allocator.context = arena;
+    return &arena->allocator;
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+// JesterAllocator_t adapter
+// ---------------------------------------------------------------------------------------------------------------
+
+// --- true if ptr/size is the most recent allocation in the current chunk ---
+static bool is_top_allocation(const Arena_t* arena, const void* ptr, const size_t size)
+{
+    ArenaChunk_t* chunk = arena->current;
+    return chunk && (const unsigned char*)ptr + size == chunk_data(chunk) + chunk->used;
+}
+
+static void* arena_allocator_allocate(void* context, const size_t size)
+{
+    return allocate_arena(context, size);
+}
+
+static void* arena_allocator_reallocate(void* context, void* ptr, const size_t old_size, const size_t new_size)
+{
+    Arena_t* arena = context;
+    if (ptr == NULL) return allocate_arena(arena, new_size);
+
+    // --- grow or shrink the top allocation in place when it fits ---
+    if (is_top_allocation(arena, ptr, old_size))
+    {
+        const size_t offset = (size_t)((unsigned char*)ptr - chunk_data(arena->current));
+        if (new_size <= arena->current->capacity - offset)
+        {
+            arena->current->used = offset + new_size;
+            return ptr;
+        }
+    }
+
+    // --- otherwise copy into a fresh block, the old one dies with the arena ---
+    void* fresh = allocate_arena(arena, new_size);
+    if (fresh) memcpy(fresh, ptr, old_size < new_size ? old_size : new_size);
+    return fresh;
+}
+
+static void arena_allocator_deallocate(void* context, void* ptr, const size_t size)
+{
+    Arena_t* arena = context;
+    if (ptr && is_top_allocation(arena, ptr, size))
+    {
+        arena->current->used = (size_t)((unsigned char*)ptr - chunk_data(arena->current));
+    }
+}
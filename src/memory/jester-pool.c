@@ -0,0 +1,334 @@
+﻿/**
+ * @file      jester-pool.c
+ * @brief     Implementation of the fixed-size pool allocator for the Jester stdlib.
+ *
+ * @details   Free blocks double as list nodes: the first word of a free block
+ *            points to the next one. Slabs are only released when the whole
+ *            pool is freed. Magazine transfers move half a magazine at a time,
+ *            so a thread that alternates between allocating and freeing around
+ *            the boundary does not bounce on the shared lock.
+ *
+ *            A magazine is never held across pool->lock: blocks moving to or
+ *            from the shared list are unlinked into a private chain first, so a
+ *            thread blocked on the mutex cannot stall a thread sharing its slot.
+ *
+ * @copyright GPL-3.0
+ * @author    Case Presley
+ * @date      10-16-2026
+ */
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include "jester/memory/jester-pool.h"                     // |
+#include <sched.h>                                         // |
+#include <stdint.h>                                        // |
+#include <string.h>                                        // |
+//------------------------------------------------------------┙
+
+typedef struct PoolSlab
+{
+    struct PoolSlab* next;
+    size_t size;  // total bytes including this header
+} PoolSlab_t;
+
+#define SLAB_HEADER_SIZE 64  // keeps the first block cache-line aligned
+#define CACHE_LINE       64
+#define TRANSFER_COUNT   (JESTER_POOL_MAGAZINE_SIZE / 2)
+
+#define SHARED_SLOT_TAG  ((uintptr_t)1)  // marks a magazine the thread borrows but does not own
+
+static void* pool_allocator_allocate(void* context, size_t size);
+static void* pool_allocator_reallocate(void* context, void* ptr, size_t old_size, size_t new_size);
+static void pool_allocator_deallocate(void* context, void* ptr, size_t size);
+
+// --- bind the calling thread to a free magazine, or borrow one when every slot is owned ---
+static PoolCache_t* claim_thread_cache(Pool_t* pool)
+{
+    for (size_t i = 0; i < JESTER_POOL_MAX_THREAD_CACHES; i++)
+    {
+        PoolCache_t* cache = &pool->caches[i];
+        bool expected      = false;
+        if (atomic_load_explicit(&cache->owned, memory_order_relaxed)) continue;
+        if (!atomic_compare_exchange_strong_explicit(&cache->owned, &expected, true, memory_order_acquire,
+                                                     memory_order_relaxed))
+        {
+            continue;
+        }
+
+        cache->pool = pool;
+        if (pthread_setspecific(pool->thread_key, cache) == 0) return cache;
+
+        // --- without a key value the exit hook would never release the slot ---
+        atomic_store_explicit(&cache->owned, false, memory_order_release);
+        return cache;
+    }
+
+    static _Atomic unsigned next_shared_slot;
+    PoolCache_t* cache = &pool->caches[atomic_fetch_add(&next_shared_slot, 1) % JESTER_POOL_MAX_THREAD_CACHES];
+    pthread_setspecific(pool->thread_key, (void*)((uintptr_t)cache | SHARED_SLOT_TAG));
+    return cache;
+}
+
+// --- returns the thread's magazine with busy held, or NULL if a thread borrowing it holds it ---
+static PoolCache_t* lock_thread_cache(Pool_t* pool)
+{
+    const uintptr_t slot = (uintptr_t)pthread_getspecific(pool->thread_key);
+    PoolCache_t* cache   = slot ? (PoolCache_t*)(slot & ~SHARED_SLOT_TAG) : claim_thread_cache(pool);
+    return atomic_flag_test_and_set_explicit(&cache->busy, memory_order_acquire) ? NULL : cache;
+}
+
+static void unlock_thread_cache(PoolCache_t* cache)
+{
+    atomic_flag_clear_explicit(&cache->busy, memory_order_release);
+}
+
+// --- unlink the top count blocks of a held magazine into a NULL-terminated chain ---
+static void* unlink_cached_blocks(PoolCache_t* cache, unsigned count)
+{
+    void* chain = NULL;
+    while (count-- > 0)
+    {
+        void* block    = cache->blocks[--cache->count];
+        *(void**)block = chain;
+        chain          = block;
+    }
+    return chain;
+}
+
+// --- splice a NULL-terminated chain onto the shared free list; no magazine may be held ---
+static void give_shared_blocks(Pool_t* pool, void* chain)
+{
+    if (chain == NULL) return;
+
+    void* tail = chain;
+    while (*(void**)tail) tail = *(void**)tail;
+
+    pthread_mutex_lock(&pool->lock);
+    *(void**)tail   = pool->free_list;
+    pool->free_list = chain;
+    pthread_mutex_unlock(&pool->lock);
+}
+
+// --- pthread key destructor: hand an exiting thread's magazine back and free its slot ---
+static void release_thread_cache(void* slot)
+{
+    if ((uintptr_t)slot & SHARED_SLOT_TAG) return;
+
+    // --- a borrower only ever holds busy briefly and never across a lock ---
+    PoolCache_t* cache = slot;
+    while (atomic_flag_test_and_set_explicit(&cache->busy, memory_order_acquire)) sched_yield();
+    void* chain = unlink_cached_blocks(cache, cache->count);
+    unlock_thread_cache(cache);
+
+    give_shared_blocks(cache->pool, chain);
+    atomic_store_explicit(&cache->owned, false, memory_order_release);
+}
+
+// --- carve a new slab into the shared free list, pool->lock must be held ---
+static bool grow_pool(Pool_t* pool)
+{
+    const size_t size = SLAB_HEADER_SIZE + pool->block_size * pool->blocks_per_slab;
+    PoolSlab_t* slab  = jester_allocate(pool->backing, size);
+    if (slab == NULL) return false;
+
+    slab->size  = size;
+    slab->next  = pool->slabs;
+    pool->slabs = slab;
+
+    // --- thread blocks back to front so the list hands them out in address order ---
+    unsigned char* first = (unsigned char*)slab + SLAB_HEADER_SIZE;
+    for (size_t i = pool->blocks_per_slab; i-- > 0;)
+    {
+        void* block     = first + i * pool->block_size;
+        *(void**)block  = pool->free_list;
+        pool->free_list = block;
+    }
+    return true;
+}
+
+// --- detach up to count blocks from the shared list as a NULL-terminated chain, pool->lock must be held ---
+static void* take_shared_blocks(Pool_t* pool, unsigned count)
+{
+    void* chain = NULL;
+    while (count-- > 0)
+    {
+        if (pool->free_list == NULL && !grow_pool(pool)) break;
+
+        void* block     = pool->free_list;
+        pool->free_list = *(void**)block;
+        *(void**)block  = chain;
+        chain           = block;
+    }
+    return chain;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, failures leave caches = NULL               |
+//-----------------------------------------------------┙
+Pool_t create_pool_with_allocator(const size_t block_size, const size_t blocks_per_slab,
+                                  const JesterAllocator_t* backing)
+{
+    Pool_t pool = {};  // initialize to defaults
+
+    // --- blocks hold the free-list pointer and keep natural alignment ---
+    size_t size = block_size < sizeof(void*) ? sizeof(void*) : block_size;
+    size        = size >= 16 ? (size + 15) & ~(size_t)15 : (size + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+
+    pool.block_size      = size;
+    pool.blocks_per_slab = blocks_per_slab ? blocks_per_slab : JESTER_POOL_DEFAULT_SLAB_COUNT;
+    pool.backing         = backing;
+    pool.lock            = (pthread_mutex_t)PTHREAD_MUTEX_INITIALIZER;
+
+    pool.allocator.allocate   = pool_allocator_allocate;
+    pool.allocator.reallocate = pool_allocator_reallocate;
+    pool.allocator.deallocate = pool_allocator_deallocate;
+
+    // --- one cache-line aligned magazine per thread slot ---
+    const size_t caches_size = sizeof(PoolCache_t) * JESTER_POOL_MAX_THREAD_CACHES + CACHE_LINE;
+    pool.caches_block        = jester_allocate(backing, caches_size);
+    if (pool.caches_block == NULL) return pool;
+
+    memset(pool.caches_block, 0, caches_size);
+    const uintptr_t aligned = ((uintptr_t)pool.caches_block + CACHE_LINE - 1) & ~(uintptr_t)(CACHE_LINE - 1);
+    pool.caches             = (PoolCache_t*)aligned;
+    for (size_t i = 0; i < JESTER_POOL_MAX_THREAD_CACHES; i++) atomic_flag_clear(&pool.caches[i].busy);
+
+    // --- the key's destructor returns an exiting thread's magazine and frees its slot ---
+    if (pthread_key_create(&pool.thread_key, release_thread_cache) != 0)
+    {
+        jester_deallocate(backing, pool.caches_block, caches_size);
+        pool.caches_block = NULL;
+        pool.caches       = NULL;
+    }
+
+    return pool;
+}
+
+Pool_t create_pool(const size_t block_size, const size_t blocks_per_slab)
+{
+    return create_pool_with_allocator(block_size, blocks_per_slab, NULL);
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return NULL on failure                     |
+//-----------------------------------------------------┙
+void* allocate_pool_block(Pool_t* pool)
+{
+    if (pool->caches == NULL) return NULL;
+
+    PoolCache_t* cache = lock_thread_cache(pool);
+    if (cache && cache->count)
+    {
+        void* block = cache->blocks[--cache->count];
+        unlock_thread_cache(cache);
+        return block;
+    }
+    if (cache) unlock_thread_cache(cache);
+
+    // --- refill half a magazine from the shared list without holding the magazine ---
+    pthread_mutex_lock(&pool->lock);
+    void* chain = take_shared_blocks(pool, cache ? TRANSFER_COUNT : 1);
+    pthread_mutex_unlock(&pool->lock);
+    if (chain == NULL) return NULL;
+
+    void* block = chain;
+    chain       = *(void**)block;
+    if (chain == NULL) return block;
+
+    // --- stash the rest if the magazine is still ours and has room, otherwise hand it back ---
+    cache = lock_thread_cache(pool);
+    if (cache)
+    {
+        while (chain && cache->count < JESTER_POOL_MAGAZINE_SIZE)
+        {
+            cache->blocks[cache->count++] = chain;
+            chain                         = *(void**)chain;
+        }
+        unlock_thread_cache(cache);
+    }
+    give_shared_blocks(pool, chain);
+    return block;
+}
+
+void free_pool_block(Pool_t* pool, void* block)
+{
+    if (block == NULL || pool->caches == NULL) return;
+
+    PoolCache_t* cache = lock_thread_cache(pool);
+    if (cache == NULL)
+    {
+        *(void**)block = NULL;
+        give_shared_blocks(pool, block);
+        return;
+    }
+
+    // --- spill half a magazine back to the shared list when full, after releasing the magazine ---
+    void* spilled = cache->count == JESTER_POOL_MAGAZINE_SIZE ? unlink_cached_blocks(cache, TRANSFER_COUNT) : NULL;
+    cache->blocks[cache->count++] = block;
+    unlock_thread_cache(cache);
+    give_shared_blocks(pool, spilled);
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool free_pool(Pool_t* pool)
+{
+    bool freed = false;
+
+    // --- release every slab ---
+    while (pool->slabs)
+    {
+        PoolSlab_t* next = pool->slabs->next;
+        jester_deallocate(pool->backing, pool->slabs, pool->slabs->size);
+        pool->slabs = next;
+        freed       = true;
+    }
+
+    // --- release the magazines ---
+    if (pool->caches_block)
+    {
+        pthread_key_delete(pool->thread_key);
+        const size_t caches_size = sizeof(PoolCache_t) * JESTER_POOL_MAX_THREAD_CACHES + CACHE_LINE;
+        jester_deallocate(pool->backing, pool->caches_block, caches_size);
+        freed = true;
+    }
+
+    pool->caches_block = NULL;
+    pool->caches       = NULL;
+    pool->free_list    = NULL;
+    pthread_mutex_destroy(&pool->lock);
+    return freed;
+}
+
+const JesterAllocator_t* get_pool_allocator(Pool_t* pool)
+{
+    pool->allocator.context = pool;
+    return &pool->allocator;
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+// JesterAllocator_t adapter
+// ---------------------------------------------------------------------------------------------------------------
+
+static void* pool_allocator_allocate(void* context, const size_t size)
+{
+    Pool_t* pool = context;
+    return size <= pool->block_size ? allocate_pool_block(pool) : NULL;
+}
+
+static void* pool_allocator_reallocate(void* context, void* ptr, const size_t old_size, const size_t new_size)
+{
+    (void)old_size;
+    Pool_t* pool = context;
+    if (new_size > pool->block_size) return NULL;
+    return ptr ? ptr : allocate_pool_block(pool);
+}
+
+static void pool_allocator_deallocate(void* context, void* ptr, const size_t size)
+{
+    (void)size;
+    free_pool_block(context, ptr);
+}
@@ -0,0 +1,152 @@
+﻿/**
+ * @file      jester-intern.c
+ * @brief     Implementation of the string interning pool for the Jester stdlib.
+ *
+ * @details   The map is keyed by StringView_t values pointing into the arena,
+ *            hashed and compared by the bytes they point to. Because those
+ *            bytes never change or move, the map's custom equality can safely
+ *            follow the pointers in a (validated) key snapshot.
+ *
+ *            Publishing order for a new string, under the pool mutex: copy
+ *            the bytes, push the view, bump count (release), then insert into
+ *            the map. Any thread that obtains an id, from the map or from a
+ *            count it has read, therefore also sees that id's view. Id lookups
+ *            take no lock: they bounds-check against the pool's count with
+ *            acquire ordering, then go straight to the element's segment, whose
+ *            pointer never changes once set. The segmented array's own count is
+ *            written under the lock, so lookups must not read it.
+ *
+ * @copyright GPL-3.0
+ * @author    Case Presley
+ * @date      10-17-2026
+ */
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include "jester/string/jester-intern.h"                   // |
+#include <string.h>                                        // |
+//------------------------------------------------------------┙
+
+static uint64_t hash_intern_key(const void* key, const size_t key_size)
+{
+    (void)key_size;
+    return hash_string_view(*(const StringView_t*)key);
+}
+
+static bool equals_intern_key(const void* a, const void* b, const size_t key_size)
+{
+    (void)key_size;
+    return equals_string_view(*(const StringView_t*)a, *(const StringView_t*)b);
+}
+
+InternPool_t create_intern_pool_with_allocator(const JesterAllocator_t* allocator)
+{
+    InternPool_t pool = {};  // initialize to defaults
+    pool.index   = create_concurrent_map_custom(sizeof(StringView_t), sizeof(InternId_t), 0, hash_intern_key,
+                                                equals_intern_key, allocator);
+    pool.strings = create_segmented_array_with_allocator(sizeof(StringView_t), allocator);
+    pool.bytes   = create_arena_with_allocator(0, allocator);
+    pool.lock    = (pthread_mutex_t)PTHREAD_MUTEX_INITIALIZER;
+    atomic_init(&pool.count, 0);
+    return pool;
+}
+
+InternPool_t create_intern_pool(void)
+{
+    return create_intern_pool_with_allocator(NULL);
+}
+
+InternId_t find_intern_string(const InternPool_t* pool, const StringView_t view)
+{
+    InternId_t id;
+    return get_concurrent_map(&pool->index, &view, &id) ? id : JESTER_INTERN_INVALID_ID;
+}
+
+// --- copy and publish a string not in the pool yet; the pool lock must be held ---
+static InternId_t add_intern_string(InternPool_t* pool, const StringView_t view)
+{
+    const uint32_t count = atomic_load_explicit(&pool->count, memory_order_relaxed);
+    if (pool->index.shards == NULL || count == JESTER_INTERN_INVALID_ID || view.size == SIZE_MAX)
+    {
+        return JESTER_INTERN_INVALID_ID;
+    }
+
+    // --- canonical NUL-terminated copy in the arena ---
+    char* bytes = allocate_arena_aligned(&pool->bytes, view.size + 1, 1);
+    if (bytes == NULL) return JESTER_INTERN_INVALID_ID;
+    if (view.size) memcpy(bytes, view.data, view.size);
+    bytes[view.size] = '\0';
+
+    const StringView_t stored = {bytes, view.size};
+    if (push_segmented_array(&pool->strings, &stored) == NULL) return JESTER_INTERN_INVALID_ID;
+
+    // --- publish the id before the map can hand it out (if the insert fails the id is only reachable by number) ---
+    atomic_store_explicit(&pool->count, count + 1, memory_order_release);
+    return insert_concurrent_map(&pool->index, &stored, &count) ? count : JESTER_INTERN_INVALID_ID;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return JESTER_INTERN_INVALID_ID on failure |
+//-----------------------------------------------------┙
+InternId_t intern_string(InternPool_t* pool, const StringView_t view)
+{
+    // --- fast path: already interned, no lock taken ---
+    InternId_t id = find_intern_string(pool, view);
+    if (id != JESTER_INTERN_INVALID_ID) return id;
+
+    // --- another thread may have interned it while we waited for the lock ---
+    pthread_mutex_lock(&pool->lock);
+    id = find_intern_string(pool, view);
+    if (id == JESTER_INTERN_INVALID_ID) id = add_intern_string(pool, view);
+    pthread_mutex_unlock(&pool->lock);
+    return id;
+}
+
+InternId_t intern_cstr(InternPool_t* pool, const char* cstr)
+{
+    return intern_string(pool, create_string_view(cstr));
+}
+
+// --- the stored view of an id, or NULL if it is not published; takes no lock ---
+static const StringView_t* find_stored_view(const InternPool_t* pool, const InternId_t id)
+{
+    if (id >= atomic_load_explicit(&pool->count, memory_order_acquire)) return NULL;
+    return get_segmented_array_element_unchecked(&pool->strings, id);
+}
+
+StringView_t get_intern_view(const InternPool_t* pool, const InternId_t id)
+{
+    const StringView_t* stored = find_stored_view(pool, id);
+    if (stored == NULL)
+    {
+        const StringView_t empty = {"", 0};
+        return empty;
+    }
+    return *stored;
+}
+
+const char* get_intern_string(const InternPool_t* pool, const InternId_t id)
+{
+    const StringView_t* stored = find_stored_view(pool, id);
+    return stored ? stored->data : NULL;
+}
+
+size_t get_intern_pool_count(const InternPool_t* pool)
+{
+    return atomic_load_explicit(&pool->count, memory_order_acquire);
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool free_intern_pool(InternPool_t* pool)
+{
+    bool freed = free_concurrent_map(&pool->index);
+    freed |= free_segmented_array(&pool->strings);
+    freed |= free_arena(&pool->bytes);
+
+    pthread_mutex_destroy(&pool->lock);
+    atomic_store_explicit(&pool->count, 0, memory_order_relaxed);
+    return freed;
+}
@@ -0,0 +1,419 @@
+﻿/**
+ * @file      jester-string.c
+ * @brief     Implementation of owned strings, string builders, and string views for the Jester stdlib.
+ *
+ * @details   A String_t is inline while the top bit of its size field is clear:
+ *            the bytes and their NUL then sit in `small`, which overlays the
+ *            heap pointer and capacity. Heap strings always come from the global
+ *            heap, keeping the struct at 32 bytes. Every buffer in this file is
+ *            allocated one byte larger than its capacity to hold the NUL.
+ *
+ * @copyright GPL-3.0
+ * @author    Case Presley
+ * @date      10-17-2026
+ */
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include "jester/string/jester-string.h"                   // |
+#include "jester/hash/jester-hash.h"                       // |
+#include <stdio.h>                                         // |
+#include <string.h>                                        // |
+//------------------------------------------------------------┙
+
+#define HEAP_FLAG ((size_t)1 << ((sizeof(size_t) * 8) - 1))
+
+static bool is_heap(const String_t* s)
+{
+    return (s->size & HEAP_FLAG) != 0;
+}
+
+static char* string_buffer(String_t* s)
+{
+    return is_heap(s) ? s->heap.data : s->small;
+}
+
+static size_t string_capacity(const String_t* s)
+{
+    return is_heap(s) ? s->heap.capacity : JESTER_STRING_INLINE_CAPACITY;
+}
+
+// --- keep the size bits, preserving the storage flag ---
+static void set_string_size(String_t* s, const size_t size)
+{
+    s->size = (s->size & HEAP_FLAG) | size;
+}
+
+// --- capacity for at least needed bytes: doubling, so repeated appends stay amortized O(1) ---
+static size_t grown_capacity(const size_t capacity, const size_t needed, const size_t minimum)
+{
+    size_t grown = capacity > SIZE_MAX / 2 ? needed : capacity * 2;
+    if (grown < minimum) grown = minimum;
+    return grown > needed ? grown : needed;
+}
+
+// --- true if p points into [start, start + size), so an append source must be re-based after growing ---
+static bool points_into(const char* p, const char* start, const size_t size)
+{
+    return p && (uintptr_t)p >= (uintptr_t)start && (uintptr_t)p < (uintptr_t)start + size;
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+// String views
+// ---------------------------------------------------------------------------------------------------------------
+
+StringView_t create_string_view(const char* cstr)
+{
+    const StringView_t view = {cstr, cstr ? strlen(cstr) : 0};
+    return view;
+}
+
+StringView_t slice_string_view(const StringView_t view, size_t start, size_t length)
+{
+    if (start > view.size) start = view.size;
+    if (length > view.size - start) length = view.size - start;
+
+    const StringView_t slice = {view.data ? view.data + start : NULL, length};
+    return slice;
+}
+
+bool equals_string_view(const StringView_t a, const StringView_t b)
+{
+    return a.size == b.size && (a.size == 0 || memcmp(a.data, b.data, a.size) == 0);
+}
+
+bool starts_with_string_view(const StringView_t view, const StringView_t prefix)
+{
+    return prefix.size <= view.size && (prefix.size == 0 || memcmp(view.data, prefix.data, prefix.size) == 0);
+}
+
+size_t find_string_view(const StringView_t view, const char c)
+{
+    const char* found = view.size ? memchr(view.data, c, view.size) : NULL;
+    return found ? (size_t)(found - view.data) : SIZE_MAX;
+}
+
+uint64_t hash_string_view(const StringView_t view)
+{
+    return jester_hash(view.data, view.size, 0);
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+// Owned strings
+// ---------------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, failures give an empty string              |
+//-----------------------------------------------------┙
+String_t create_string_from_view(const StringView_t view)
+{
+    String_t string = {};  // initialize to defaults (empty, inline)
+    if (view.size == 0) return string;
+
+    if (view.size <= JESTER_STRING_INLINE_CAPACITY)
+    {
+        memcpy(string.small, view.data, view.size);
+        string.small[view.size] = '\0';
+        string.size             = view.size;
+        return string;
+    }
+
+    if (view.size == SIZE_MAX || view.size >= HEAP_FLAG) return string;
+    char* data = jester_allocate(NULL, view.size + 1);
+    if (data == NULL) return string;
+
+    memcpy(data, view.data, view.size);
+    data[view.size]      = '\0';
+    string.heap.data     = data;
+    string.heap.capacity = view.size;
+    string.size          = view.size | HEAP_FLAG;
+    return string;
+}
+
+String_t create_string(const char* cstr)
+{
+    return create_string_from_view(create_string_view(cstr));
+}
+
+const char* get_string_data(const String_t* s)
+{
+    return is_heap(s) ? s->heap.data : s->small;
+}
+
+size_t get_string_size(const String_t* s)
+{
+    return s->size & ~HEAP_FLAG;
+}
+
+bool is_string_inline(const String_t* s)
+{
+    return !is_heap(s);
+}
+
+StringView_t get_string_view(const String_t* s)
+{
+    const StringView_t view = {get_string_data(s), get_string_size(s)};
+    return view;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool reserve_string(String_t* s, const size_t capacity)
+{
+    // --- check if the current capacity is sufficient ---
+    if (capacity <= string_capacity(s)) return true;
+    if (capacity >= HEAP_FLAG - 1) return false;
+
+    const size_t size = get_string_size(s);
+    char* data;
+    if (is_heap(s))
+    {
+        data = jester_reallocate(NULL, s->heap.data, s->heap.capacity + 1, capacity + 1);
+        if (data == NULL) return false;
+    }
+    else
+    {
+        // --- leave the struct: copy the inline bytes (and NUL) out before the union is overwritten ---
+        data = jester_allocate(NULL, capacity + 1);
+        if (data == NULL) return false;
+        memcpy(data, s->small, size + 1);
+    }
+
+    s->heap.data     = data;
+    s->heap.capacity = capacity;
+    s->size          = size | HEAP_FLAG;
+    return true;
+}
+
+bool append_string(String_t* s, StringView_t view)
+{
+    if (view.size == 0) return true;
+
+    const size_t size = get_string_size(s);
+    if (view.size > SIZE_MAX - size - 1) return false;
+
+    // --- growing may move the buffer the view points into ---
+    const char* old_buffer = string_buffer(s);
+    const bool aliased     = points_into(view.data, old_buffer, size + 1);
+    const size_t offset    = aliased ? (size_t)(view.data - old_buffer) : 0;
+
+    const size_t needed = size + view.size;
+    if (needed > string_capacity(s) &&
+        !reserve_string(s, grown_capacity(string_capacity(s), needed, JESTER_STRING_INLINE_CAPACITY + 1)))
+    {
+        return false;
+    }
+
+    char* buffer = string_buffer(s);
+    if (aliased) view.data = buffer + offset;
+    memmove(buffer + size, view.data, view.size);
+    buffer[needed] = '\0';
+    set_string_size(s, needed);
+    return true;
+}
+
+bool append_string_format(String_t* s, const char* format, ...)
+{
+    const size_t size = get_string_size(s);
+    const size_t room = string_capacity(s) - size;
+
+    va_list args;
+    va_start(args, format);
+    const int written = vsnprintf(string_buffer(s) + size, room + 1, format, args);
+    va_end(args);
+
+    // --- restore the terminator a failed or truncated attempt may have moved ---
+    if (written < 0 || (size_t)written > room) string_buffer(s)[size] = '\0';
+    if (written < 0) return false;
+    if ((size_t)written <= room)
+    {
+        set_string_size(s, size + (size_t)written);
+        return true;
+    }
+
+    // --- did not fit: grow once to the exact need (or double) and format again ---
+    const size_t needed = size + (size_t)written;
+    if (!reserve_string(s, grown_capacity(string_capacity(s), needed, JESTER_STRING_INLINE_CAPACITY + 1)))
+    {
+        return false;
+    }
+
+    va_start(args, format);
+    vsnprintf(string_buffer(s) + size, (size_t)written + 1, format, args);
+    va_end(args);
+    set_string_size(s, needed);
+    return true;
+}
+
+bool clear_string(String_t* s)
+{
+    // --- mark string as empty (reuse existing storage) ---
+    string_buffer(s)[0] = '\0';
+    set_string_size(s, 0);
+    return true;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool copy_string(const String_t* source, String_t* destination)
+{
+    *destination = create_string_from_view(get_string_view(source));
+    return get_string_size(destination) == get_string_size(source);
+}
+
+bool free_string(String_t* s)
+{
+    const bool freed = is_heap(s);
+    if (freed) jester_deallocate(NULL, s->heap.data, s->heap.capacity + 1);
+
+    const String_t empty = {};
+    *s                   = empty;
+    return freed;
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+// String builders
+// ---------------------------------------------------------------------------------------------------------------
+
+StringBuilder_t create_string_builder_with_allocator(const size_t capacity, const JesterAllocator_t* allocator)
+{
+    StringBuilder_t builder = {};  // initialize to defaults
+    builder.allocator       = allocator;
+
+    if (capacity != 0) reserve_string_builder(&builder, capacity);
+    return builder;
+}
+
+StringBuilder_t create_string_builder(const size_t capacity)
+{
+    return create_string_builder_with_allocator(capacity, NULL);
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool reserve_string_builder(StringBuilder_t* b, const size_t capacity)
+{
+    // --- check if the current capacity is sufficient ---
+    if (b->data && capacity <= b->capacity) return true;
+    if (capacity == SIZE_MAX) return false;
+
+    const size_t old_bytes = b->data ? b->capacity + 1 : 0;
+    char* data             = jester_reallocate(b->allocator, b->data, old_bytes, capacity + 1);
+    if (data == NULL) return false;
+
+    data[b->size] = '\0';
+    b->data       = data;
+    b->capacity   = capacity;
+    return true;
+}
+
+// --- make room for extra more bytes, doubling when that is larger ---
+static bool grow_string_builder(StringBuilder_t* b, const size_t extra)
+{
+    if (extra > SIZE_MAX - b->size - 1) return false;
+
+    const size_t needed = b->size + extra;
+    if (b->data && needed <= b->capacity) return true;
+    return reserve_string_builder(b, grown_capacity(b->capacity, needed, JESTER_STRING_BUILDER_MIN_CAPACITY));
+}
+
+bool append_string_builder(StringBuilder_t* b, StringView_t view)
+{
+    if (view.size == 0) return true;
+
+    // --- growing may move the buffer the view points into ---
+    const bool aliased  = b->data && points_into(view.data, b->data, b->size + 1);
+    const size_t offset = aliased ? (size_t)(view.data - b->data) : 0;
+    if (!grow_string_builder(b, view.size)) return false;
+
+    if (aliased) view.data = b->data + offset;
+    memmove(b->data + b->size, view.data, view.size);
+    b->size += view.size;
+    b->data[b->size] = '\0';
+    return true;
+}
+
+bool append_string_builder_char(StringBuilder_t* b, const char c)
+{
+    if (!grow_string_builder(b, 1)) return false;
+
+    b->data[b->size++] = c;
+    b->data[b->size]   = '\0';
+    return true;
+}
+
+bool append_string_builder_vformat(StringBuilder_t* b, const char* format, va_list args)
+{
+    // --- make sure there is a buffer to format into ---
+    if (b->data == NULL && !grow_string_builder(b, 0)) return false;
+
+    va_list retry;
+    va_copy(retry, args);
+
+    // --- first attempt straight into the spare capacity ---
+    const size_t room = b->capacity - b->size;
+    const int written = vsnprintf(b->data + b->size, room + 1, format, args);
+    if (written < 0 || (size_t)written > room) b->data[b->size] = '\0';
+
+    bool ok = written >= 0;
+    if (ok && (size_t)written > room)
+    {
+        // --- did not fit: grow and format again ---
+        ok = grow_string_builder(b, (size_t)written);
+        if (ok) vsnprintf(b->data + b->size, (size_t)written + 1, format, retry);
+    }
+    va_end(retry);
+
+    if (ok) b->size += (size_t)written;
+    return ok;
+}
+
+bool append_string_builder_format(StringBuilder_t* b, const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    const bool ok = append_string_builder_vformat(b, format, args);
+    va_end(args);
+    return ok;
+}
+
+StringView_t get_string_builder_view(const StringBuilder_t* b)
+{
+    const StringView_t view = {b->data ? b->data : "", b->size};
+    return view;
+}
+
+String_t build_string(const StringBuilder_t* b)
+{
+    return create_string_from_view(get_string_builder_view(b));
+}
+
+bool clear_string_builder(StringBuilder_t* b)
+{
+    // --- mark builder as empty (reuse existing storage) ---
+    b->size = 0;
+    if (b->data) b->data[0] = '\0';
+    return true;
+}
+
+//-----------------------------------------------------┑
+// TODO: Add assertions when utils is integrated.      |
+// For now, return booleans for simple success/failure |
+//-----------------------------------------------------┙
+bool free_string_builder(StringBuilder_t* b)
+{
+    // --- nothing allocated yet ---
+    if (b->data == NULL) return false;
+
+    jester_deallocate(b->allocator, b->data, b->capacity + 1);
+    b->data     = NULL;
+    b->size     = 0;
+    b->capacity = 0;
+    return true;
+}
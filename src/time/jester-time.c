@@ -0,0 +1,308 @@
+﻿/**
+ * @file      jester-time.c
+ * @brief     Implementation of the TSC-based clock for the Jester stdlib.
+ *
+ * @details   Conversion parameters (anchor cycles, anchor nanoseconds, fixed-point
+ *            multiplier and wall-clock offset) are published through a seqlock, so
+ *            readers never take a lock or write shared memory. The multiplier is a
+ *            32.32 fixed-point ns-per-cycle value; each re-synchronization derives the
+ *            TSC rate from the whole interval since the first anchor, which makes it
+ *            more precise the longer the process runs.
+ *
+ *            Errors are slewed rather than stepped: a re-synchronization continues
+ *            the published line from the present and scales the rate so the clock
+ *            meets CLOCK_MONOTONIC at the next one. Running ahead is corrected by
+ *            running slower, so the clock converges without ever stepping back.
+ *
+ * @copyright GPL-3.0
+ * @author    Case Presley
+ * @date      10-16-2026
+ */
+
+//-------------------- INCLUDE FILES -------------------------┑
+#include "jester/time/jester-time.h"                       // |
+#include <pthread.h>                                       // |
+#include <stdatomic.h>                                     // |
+#include <time.h>                                          // |
+#if defined(__x86_64__) || defined(__i386__)               // |
+#include <cpuid.h>                                         // |
+#include <x86intrin.h>                                     // |
+#define JESTER_TIME_HAS_RDTSC 1                            // |
+#endif                                                     // |
+//------------------------------------------------------------┙
+
+#define CALIBRATION_NS 5000000ull  // initial calibration window (5 ms)
+#define ANCHOR_SAMPLES 5
+
+typedef struct TimeAnchor
+{
+    uint64_t cycles;
+    uint64_t mono_ns;
+    uint64_t wall_ns;
+} TimeAnchor_t;
+
+// --- seqlock protected conversion parameters ---
+static _Atomic uint32_t params_seq;
+static _Atomic uint64_t params_base_cycles;
+static _Atomic uint64_t params_base_ns;
+static _Atomic uint64_t params_mult;
+static _Atomic int64_t  params_wall_offset_ns;
+
+static _Atomic bool time_ready;
+static bool tsc_available;
+static TimeAnchor_t first_anchor;
+
+static pthread_mutex_t init_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t resync_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t resync_cond = PTHREAD_COND_INITIALIZER;
+static pthread_t resync_thread;
+static bool resync_running;
+static bool resync_stop;
+
+static uint64_t clock_ns(const clockid_t clock)
+{
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static inline uint64_t read_tsc(void)
+{
+#ifdef JESTER_TIME_HAS_RDTSC
+    return __rdtsc();
+#else
+    return clock_ns(CLOCK_MONOTONIC);
+#endif
+}
+
+static bool detect_invariant_tsc(void)
+{
+#ifdef JESTER_TIME_HAS_RDTSC
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) || eax < 0x80000007) return false;
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx)) return false;
+    return (edx & (1u << 8)) != 0;  // invariant TSC flag
+#else
+    return false;
+#endif
+}
+
+// --- pair a TSC reading with CLOCK_MONOTONIC, keeping the tightest of several brackets ---
+static TimeAnchor_t sample_anchor(void)
+{
+    TimeAnchor_t anchor = {0};
+    uint64_t best_window = UINT64_MAX;
+
+    for (int i = 0; i < ANCHOR_SAMPLES; i++)
+    {
+        const uint64_t before = read_tsc();
+        const uint64_t mono   = clock_ns(CLOCK_MONOTONIC);
+        const uint64_t after  = read_tsc();
+
+        if (after - before < best_window)
+        {
+            best_window    = after - before;
+            anchor.cycles  = before + (after - before) / 2;
+            anchor.mono_ns = mono;
+        }
+    }
+
+    anchor.wall_ns = clock_ns(CLOCK_REALTIME) - (clock_ns(CLOCK_MONOTONIC) - anchor.mono_ns);
+    return anchor;
+}
+
+static uint64_t convert_cycles(const uint64_t cycles, const uint64_t base_cycles, const uint64_t base_ns,
+                               const uint64_t mult)
+{
+    const __int128 delta = (__int128)(int64_t)(cycles - base_cycles);
+    return base_ns + (uint64_t)(int64_t)((delta * (__int128)mult) >> 32);
+}
+
+static void publish_params(const uint64_t base_cycles, const uint64_t base_ns, const uint64_t mult,
+                           const int64_t wall_offset_ns)
+{
+    const uint32_t seq = atomic_load_explicit(&params_seq, memory_order_relaxed);
+    atomic_store_explicit(&params_seq, seq + 1, memory_order_relaxed);  // odd: write in progress
+    atomic_thread_fence(memory_order_release);
+
+    atomic_store_explicit(&params_base_cycles, base_cycles, memory_order_relaxed);
+    atomic_store_explicit(&params_base_ns, base_ns, memory_order_relaxed);
+    atomic_store_explicit(&params_mult, mult, memory_order_relaxed);
+    atomic_store_explicit(&params_wall_offset_ns, wall_offset_ns, memory_order_relaxed);
+
+    atomic_store_explicit(&params_seq, seq + 2, memory_order_release);
+}
+
+static void read_params(uint64_t* base_cycles, uint64_t* base_ns, uint64_t* mult, int64_t* wall_offset_ns)
+{
+    uint32_t seq;
+    do
+    {
+        seq             = atomic_load_explicit(&params_seq, memory_order_acquire);
+        *base_cycles    = atomic_load_explicit(&params_base_cycles, memory_order_relaxed);
+        *base_ns        = atomic_load_explicit(&params_base_ns, memory_order_relaxed);
+        *mult           = atomic_load_explicit(&params_mult, memory_order_relaxed);
+        *wall_offset_ns = atomic_load_explicit(&params_wall_offset_ns, memory_order_relaxed);
+        atomic_thread_fence(memory_order_acquire);
+    } while ((seq & 1u) || seq != atomic_load_explicit(&params_seq, memory_order_relaxed));
+}
+
+// --- resync_lock must be held: publish_params() supports a single writer ---
+static void resync(void)
+{
+    const TimeAnchor_t anchor = sample_anchor();
+    if (anchor.cycles <= first_anchor.cycles) return;
+
+    // --- derive the rate from the full interval since the first anchor ---
+    const unsigned __int128 elapsed_ns = (unsigned __int128)(anchor.mono_ns - first_anchor.mono_ns) << 32;
+    const uint64_t rate = (uint64_t)(elapsed_ns / (anchor.cycles - first_anchor.cycles));
+
+    // --- re-base at the present on the published line, so publishing never steps the clock back ---
+    uint64_t old_cycles, old_ns, old_mult;
+    int64_t old_wall;
+    read_params(&old_cycles, &old_ns, &old_mult, &old_wall);
+    const uint64_t now_cycles = read_tsc();
+    uint64_t base_ns          = convert_cycles(now_cycles, old_cycles, old_ns, old_mult);
+    const uint64_t mono_ns    = convert_cycles(now_cycles, anchor.cycles, anchor.mono_ns, rate);
+
+    // --- slew: run fast or slow so the clock meets CLOCK_MONOTONIC at the next resync ---
+    const int64_t interval_ns = JESTER_TIME_RESYNC_INTERVAL_MS * 1000000ll;
+    int64_t error_ns          = (int64_t)(mono_ns - base_ns);
+    if (error_ns > interval_ns / 2)
+    {
+        base_ns  = mono_ns;  // far behind: a forward step keeps the clock monotonic
+        error_ns = 0;
+    }
+    if (error_ns < -interval_ns / 2) error_ns = -interval_ns / 2;  // far ahead: half speed until caught up
+
+    const uint64_t mult = (uint64_t)(((unsigned __int128)rate * (uint64_t)(interval_ns + error_ns)) / interval_ns);
+    publish_params(now_cycles, base_ns, mult, (int64_t)(anchor.wall_ns - anchor.mono_ns));
+}
+
+static void* resync_main(void* arg)
+{
+    (void)arg;
+
+    pthread_mutex_lock(&resync_lock);
+    while (!resync_stop)
+    {
+        struct timespec deadline;
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += JESTER_TIME_RESYNC_INTERVAL_MS / 1000;
+        deadline.tv_nsec += (JESTER_TIME_RESYNC_INTERVAL_MS % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L)
+        {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+
+        pthread_cond_timedwait(&resync_cond, &resync_lock, &deadline);
+        if (resync_stop) break;
+
+        resync();
+    }
+    pthread_mutex_unlock(&resync_lock);
+
+    return NULL;
+}
+
+bool jester_time_init(void)
+{
+    pthread_mutex_lock(&init_lock);
+
+    if (!atomic_load(&time_ready))
+    {
+        tsc_available = detect_invariant_tsc();
+
+        if (tsc_available)
+        {
+            // --- initial calibration over a short busy-wait window ---
+            first_anchor = sample_anchor();
+            while (clock_ns(CLOCK_MONOTONIC) - first_anchor.mono_ns < CALIBRATION_NS) {}
+            const TimeAnchor_t second = sample_anchor();
+
+            const uint64_t mult = (uint64_t)(((unsigned __int128)(second.mono_ns - first_anchor.mono_ns) << 32)
+                                             / (second.cycles - first_anchor.cycles));
+            publish_params(second.cycles, second.mono_ns, mult, (int64_t)(second.wall_ns - second.mono_ns));
+        }
+
+        atomic_store(&time_ready, true);
+    }
+
+    // --- (re)start the background re-synchronization thread ---
+    if (tsc_available && !resync_running)
+    {
+        resync_stop    = false;
+        resync_running = pthread_create(&resync_thread, NULL, resync_main, NULL) == 0;
+    }
+
+    pthread_mutex_unlock(&init_lock);
+    return tsc_available;
+}
+
+void jester_time_shutdown(void)
+{
+    pthread_mutex_lock(&init_lock);
+
+    if (resync_running)
+    {
+        pthread_mutex_lock(&resync_lock);
+        resync_stop = true;
+        pthread_cond_signal(&resync_cond);
+        pthread_mutex_unlock(&resync_lock);
+
+        pthread_join(resync_thread, NULL);
+        resync_running = false;
+    }
+
+    pthread_mutex_unlock(&init_lock);
+}
+
+void jester_time_resync(void)
+{
+    if (!atomic_load_explicit(&time_ready, memory_order_acquire)) jester_time_init();
+    if (!tsc_available) return;
+
+    pthread_mutex_lock(&resync_lock);
+    resync();
+    pthread_mutex_unlock(&resync_lock);
+}
+
+uint64_t jester_cycles(void)
+{
+    if (!atomic_load_explicit(&time_ready, memory_order_acquire)) jester_time_init();
+    return tsc_available ? read_tsc() : clock_ns(CLOCK_MONOTONIC);
+}
+
+uint64_t jester_cycles_per_second(void)
+{
+    if (!atomic_load_explicit(&time_ready, memory_order_acquire)) jester_time_init();
+    if (!tsc_available) return 1000000000ull;
+
+    uint64_t base_cycles, base_ns, mult;
+    int64_t wall_offset_ns;
+    read_params(&base_cycles, &base_ns, &mult, &wall_offset_ns);
+    return (uint64_t)((1000000000ull << 32) / mult);
+}
+
+uint64_t jester_now_ns(void)
+{
+    if (!atomic_load_explicit(&time_ready, memory_order_acquire)) jester_time_init();
+    if (!tsc_available) return clock_ns(CLOCK_MONOTONIC);
+
+    uint64_t base_cycles, base_ns, mult;
+    int64_t wall_offset_ns;
+    read_params(&base_cycles, &base_ns, &mult, &wall_offset_ns);
+    return convert_cycles(read_tsc(), base_cycles, base_ns, mult);
+}
+
+uint64_t jester_wall_ns(void)
+{
+    if (!atomic_load_explicit(&time_ready, memory_order_acquire)) jester_time_init();
+    if (!tsc_available) return clock_ns(CLOCK_REALTIME);
+
+    uint64_t base_cycles, base_ns, mult;
+    int64_t wall_offset_ns;
+    read_params(&base_cycles, &base_ns, &mult, &wall_offset_ns);
+    return convert_cycles(read_tsc(), base_cycles, base_ns, mult) + (uint64_t)wall_offset_ns;
+}
@@ -0,0 +1,184 @@
+﻿#include "jester/datastructs/map/jester-concurrent-map.h"
+#include "jester/hash/jester-hash.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#define WRITERS         4
+#define READERS         4
+#define KEYS_PER_WRITER 4096
+#define WRITER_OPS      200000
+#define BULK_EVERY      5000
+#define BULK_SIZE       256
+#define SHARDS          4  // few shards so readers and writers keep colliding
+
+// several words, so a read that mixes two writes shows up as a value that is not 3k throughout
+typedef struct TestValue
+{
+    uint64_t words[6];
+} TestValue_t;
+
+static ConcurrentMap_t map;
+static bool present[WRITERS * KEYS_PER_WRITER];
+static atomic_int writers_running;
+static atomic_bool wrong_value_seen;
+
+static TestValue_t value_for(const uint64_t key)
+{
+    TestValue_t value;
+    for (size_t i = 0; i < sizeof(value.words) / sizeof(value.words[0]); i++) value.words[i] = 3 * key;
+    return value;
+}
+
+static bool holds_value_for(const TestValue_t* value, const uint64_t key)
+{
+    const TestValue_t expected = value_for(key);
+    return memcmp(value, &expected, sizeof(expected)) == 0;
+}
+
+// each writer owns a key range, so it alone knows which of its keys are present
+static void* run_writer(void* argument)
+{
+    const uint64_t first = (uintptr_t)argument * KEYS_PER_WRITER;
+    uint64_t state       = first + 1;
+
+    for (int op = 0; op < WRITER_OPS; op++)
+    {
+        state              = jester_hash_u64(state);
+        const uint64_t key = first + (state % KEYS_PER_WRITER);
+
+        if (op % BULK_EVERY == 0)
+        {
+            // --- a bulk batch of consecutive keys, wrapping within the range ---
+            static _Thread_local uint64_t keys[BULK_SIZE];
+            static _Thread_local TestValue_t values[BULK_SIZE];
+            for (size_t i = 0; i < BULK_SIZE; i++)
+            {
+                keys[i]          = first + ((key - first + i) % KEYS_PER_WRITER);
+                values[i]        = value_for(keys[i]);
+                present[keys[i]] = true;
+            }
+            if (!insert_concurrent_map_bulk(&map, keys, values, BULK_SIZE)) atomic_store(&wrong_value_seen, true);
+        }
+        else if (state & 0x100)
+        {
+            const TestValue_t value = value_for(key);
+            if (!insert_concurrent_map(&map, &key, &value)) atomic_store(&wrong_value_seen, true);
+            present[key] = true;
+        }
+        else
+        {
+            TestValue_t removed;
+            const bool was_present = remove_concurrent_map(&map, &key, &removed);
+            if (was_present != present[key] || (was_present && !holds_value_for(&removed, key)))
+            {
+                atomic_store(&wrong_value_seen, true);
+            }
+            present[key] = false;
+        }
+    }
+
+    atomic_fetch_sub(&writers_running, 1);
+    return NULL;
+}
+
+// every hit must carry exactly 3k, whatever growth or backward shifting is going on
+static void* run_reader(void* argument)
+{
+    uint64_t state = (uintptr_t)argument * 7919;
+    size_t hits    = 0;
+
+    while (atomic_load(&writers_running) > 0)
+    {
+        state              = jester_hash_u64(state);
+        const uint64_t key = state % (WRITERS * KEYS_PER_WRITER);
+
+        TestValue_t value;
+        if (!get_concurrent_map(&map, &key, &value)) continue;
+
+        hits++;
+        if (!holds_value_for(&value, key)) atomic_store(&wrong_value_seen, true);
+    }
+    return (void*)hits;
+}
+
+static bool test_concurrent_readers_and_writers(void)
+{
+    map = create_concurrent_map_custom(sizeof(uint64_t), sizeof(TestValue_t), SHARDS, NULL, NULL, NULL);
+    atomic_store(&writers_running, WRITERS);
+
+    pthread_t writers[WRITERS], readers[READERS];
+    for (uintptr_t i = 0; i < READERS; i++) pthread_create(&readers[i], NULL, run_reader, (void*)(i + 1));
+    for (uintptr_t i = 0; i < WRITERS; i++) pthread_create(&writers[i], NULL, run_writer, (void*)i);
+
+    size_t hits = 0;
+    for (int i = 0; i < WRITERS; i++) pthread_join(writers[i], NULL);
+    for (int i = 0; i < READERS; i++)
+    {
+        void* reader_hits;
+        pthread_join(readers[i], &reader_hits);
+        hits += (uintptr_t)reader_hits;
+    }
+
+    bool ok = !atomic_load(&wrong_value_seen) && hits > 0;
+    if (!ok) puts("concurrent-map-test: a reader or writer saw a wrong value");
+
+    // --- the final contents must match what the writers recorded ---
+    size_t expected_count = 0;
+    for (uint64_t key = 0; key < WRITERS * KEYS_PER_WRITER; key++)
+    {
+        TestValue_t value;
+        const bool found = get_concurrent_map(&map, &key, &value);
+        expected_count += present[key];
+        if (found != present[key] || (found && !holds_value_for(&value, key)))
+        {
+            printf("concurrent-map-test: key %llu is wrong after the run\n", (unsigned long long)key);
+            ok = false;
+            break;
+        }
+    }
+    ok = ok && get_concurrent_map_count(&map) == expected_count;
+
+    reclaim_concurrent_map(&map);
+    free_concurrent_map(&map);
+    return ok;
+}
+
+// bulk inserts overwrite existing keys, and among duplicates in one batch the later pair wins
+static bool test_bulk_insert(void)
+{
+    ConcurrentMap_t bulk = create_concurrent_map_custom(sizeof(uint64_t), sizeof(uint64_t), 8, NULL, NULL, NULL);
+
+    const uint64_t stale = 0;
+    for (uint64_t key = 0; key < 1000; key += 2) insert_concurrent_map(&bulk, &key, &stale);
+
+    static uint64_t keys[20001], values[20001];
+    for (uint64_t i = 0; i < 20000; i++)
+    {
+        keys[i]   = i;
+        values[i] = 3 * i;
+    }
+    keys[20000]   = 17;  // duplicate of an earlier pair in the same batch
+    values[20000] = 52;
+
+    bool ok = insert_concurrent_map_bulk(&bulk, keys, values, 20001) && get_concurrent_map_count(&bulk) == 20000;
+    for (uint64_t key = 0; ok && key < 20000; key++)
+    {
+        uint64_t value;
+        ok = get_concurrent_map(&bulk, &key, &value) && value == (key == 17 ? 52 : 3 * key);
+    }
+
+    free_concurrent_map(&bulk);
+    if (!ok) puts("concurrent-map-test: bulk insert contents are wrong");
+    return ok;
+}
+
+int main()
+{
+    bool ok = test_concurrent_readers_and_writers();
+    ok      = test_bulk_insert() && ok;
+
+    puts(ok ? "concurrent-map-test: passed" : "concurrent-map-test: FAILED");
+    return ok ? 0 : 1;
+}
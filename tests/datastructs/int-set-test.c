@@ -0,0 +1,63 @@
+﻿#include "jester/datastructs/map/jester-map.h"
+#include "jester/hash/jester-hash.h"
+
+#include <stdio.h>
+
+#define KEY_RANGE  4096  // includes 0, which the table stores out of line
+#define OPERATIONS 200000
+
+JESTER_DEFINE_INT_SET(uint32_t, TestIdSet)
+
+static bool reference[KEY_RANGE];
+
+// random inserts and removes against a bitmap, then a full iteration
+int main()
+{
+    _Static_assert(sizeof(TestIdSetMapEntry_t) == sizeof(uint32_t), "an entry must be just the key");
+
+    TestIdSet_t set = create_TestIdSet();
+    size_t expected = 0;
+    uint64_t state  = 1;
+    bool ok         = true;
+
+    for (int op = 0; ok && op < OPERATIONS; op++)
+    {
+        state              = jester_hash_u64(state);
+        const uint32_t key = (uint32_t)(state % KEY_RANGE);
+
+        if (state & 0x10000)
+        {
+            bool added;
+            ok             = insert_TestIdSet(&set, key, &added) && added == !reference[key];
+            expected      += added;
+            reference[key] = true;
+        }
+        else
+        {
+            ok             = remove_TestIdSet(&set, key) == reference[key];
+            expected      -= reference[key];
+            reference[key] = false;
+        }
+        const uint32_t probe = (uint32_t)((state >> 40) % KEY_RANGE);
+        ok                   = ok && set.map.count == expected && contains_TestIdSet(&set, probe) == reference[probe];
+    }
+
+    // --- every present key exactly once ---
+    static bool visited[KEY_RANGE];
+    size_t iterator = 0, visits = 0;
+    uint32_t key;
+    while (ok && next_TestIdSet(&set, &iterator, &key))
+    {
+        ok           = key < KEY_RANGE && reference[key] && !visited[key];
+        visited[key] = true;
+        visits++;
+    }
+    ok = ok && visits == expected;
+
+    clear_TestIdSet(&set);
+    ok = ok && set.map.count == 0 && !contains_TestIdSet(&set, 0);
+    free_TestIdSet(&set);
+
+    puts(ok ? "int-set-test: passed" : "int-set-test: FAILED");
+    return ok ? 0 : 1;
+}
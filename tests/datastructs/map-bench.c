@@ -0,0 +1,58 @@
+﻿#include "jester/datastructs/map/jester-map.h"
+#include "jester/hash/jester-hash.h"
+#include "jester/time/jester-time.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define BENCH_ENTRIES 1000000
+#define BENCH_ROUNDS  4
+
+JESTER_DEFINE_INT_MAP(uint64_t, uint32_t, BenchIntMap)
+
+// hot lookups of present keys in random order: HashMap_t against a JESTER_DEFINE_INT_MAP map
+int main()
+{
+    uint64_t* keys = malloc(BENCH_ENTRIES * sizeof(uint64_t));
+    size_t* order  = malloc(BENCH_ENTRIES * sizeof(size_t));
+    if (!keys || !order) return 1;
+
+    for (size_t i = 0; i < BENCH_ENTRIES; i++)
+    {
+        keys[i]  = jester_hash_u64(i + 1) | 1;  // never 0, distinct since the finalizer is bijective
+        order[i] = (size_t)(jester_hash_u64(~i) % BENCH_ENTRIES);
+    }
+
+    HashMap_t hashmap    = create_hashmap(sizeof(uint64_t), sizeof(uint32_t));
+    BenchIntMap_t intmap = create_BenchIntMap();
+    for (uint32_t i = 0; i < BENCH_ENTRIES; i++)
+    {
+        insert_hashmap(&hashmap, &keys[i], &i);
+        insert_BenchIntMap(&intmap, keys[i], i);
+    }
+
+    uint64_t checksum = 0;
+    uint64_t start    = jester_now_ns();
+    for (int round = 0; round < BENCH_ROUNDS; round++)
+    {
+        for (size_t i = 0; i < BENCH_ENTRIES; i++) checksum += *(uint32_t*)get_hashmap_value(&hashmap, &keys[order[i]]);
+    }
+    const double hashmap_ns = (double)(jester_now_ns() - start) / (BENCH_ROUNDS * (double)BENCH_ENTRIES);
+
+    start = jester_now_ns();
+    for (int round = 0; round < BENCH_ROUNDS; round++)
+    {
+        for (size_t i = 0; i < BENCH_ENTRIES; i++) checksum -= *get_BenchIntMap(&intmap, keys[order[i]]);
+    }
+    const double intmap_ns = (double)(jester_now_ns() - start) / (BENCH_ROUNDS * (double)BENCH_ENTRIES);
+
+    printf("map-bench: %d entries, HashMap_t %.1f ns/lookup, int map %.1f ns/lookup (checksum %llu)\n",
+           BENCH_ENTRIES, hashmap_ns, intmap_ns, (unsigned long long)checksum);
+
+    free_hashmap(&hashmap);
+    free_BenchIntMap(&intmap);
+    free(keys);
+    free(order);
+    jester_time_shutdown();
+    return checksum == 0 ? 0 : 1;
+}
@@ -0,0 +1,67 @@
+﻿#include "jester/datastructs/queue/jester-priority-queue.h"
+#include "jester/hash/jester-hash.h"
+#include "jester/time/jester-time.h"
+
+#include <stdio.h>
+
+#define BENCH_ELEMENTS 1000000
+
+typedef struct BenchItem
+{
+    uint64_t key;
+    uint32_t id;
+} BenchItem_t;
+
+#define BENCH_KEY_LESS(a, b) ((a) < (b))
+JESTER_DEFINE_PRIORITY_QUEUE(uint64_t, BENCH_KEY_LESS, 4, BenchKeyQueue)
+
+static bool bench_item_less(const void* a, const void* b)
+{
+    return ((const BenchItem_t*)a)->key < ((const BenchItem_t*)b)->key;
+}
+
+// pushes BENCH_ELEMENTS random keys, then pops them all; returns ns per push+pop pair
+static double bench_generic(const size_t arity, uint64_t* checksum)
+{
+    PriorityQueue_t queue = create_priority_queue_custom(sizeof(BenchItem_t), bench_item_less, arity, false, NULL);
+    const uint64_t start  = jester_now_ns();
+
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++)
+    {
+        const BenchItem_t item = {jester_hash_u64(i), i};
+        push_priority_queue(&queue, &item, NULL);
+    }
+    BenchItem_t item;
+    while (pop_priority_queue(&queue, &item)) *checksum += item.id;
+
+    const uint64_t elapsed = jester_now_ns() - start;
+    free_priority_queue(&queue);
+    return (double)elapsed / BENCH_ELEMENTS;
+}
+
+static double bench_typed(uint64_t* checksum)
+{
+    BenchKeyQueue_t queue = create_BenchKeyQueue(0);
+    const uint64_t start  = jester_now_ns();
+
+    for (uint32_t i = 0; i < BENCH_ELEMENTS; i++) push_BenchKeyQueue(&queue, jester_hash_u64(i));
+    uint64_t key;
+    while (pop_BenchKeyQueue(&queue, &key)) *checksum ^= key;
+
+    const uint64_t elapsed = jester_now_ns() - start;
+    free_BenchKeyQueue(&queue);
+    return (double)elapsed / BENCH_ELEMENTS;
+}
+
+int main()
+{
+    uint64_t checksum = 0;
+    const double binary = bench_generic(2, &checksum);
+    const double quad   = bench_generic(4, &checksum);
+    const double typed  = bench_typed(&checksum);
+
+    printf("priority-queue-bench: %d random keys, push+pop: 2-ary %.1f ns, 4-ary %.1f ns, typed 4-ary %.1f ns"
+           " (checksum %llu)\n", BENCH_ELEMENTS, binary, quad, typed, (unsigned long long)checksum);
+    jester_time_shutdown();
+    return 0;
+}
@@ -0,0 +1,197 @@
+﻿#include "jester/datastructs/queue/jester-priority-queue.h"
+#include "jester/hash/jester-hash.h"
+
+#include <stdio.h>
+
+#define MAX_IDS    60000
+#define OPERATIONS 20000
+#define KEY_RANGE  1000  // small, so equal keys are common
+#define BATCH_SIZE 50
+
+typedef struct TestItem
+{
+    uint64_t key;
+    uint32_t id;
+} TestItem_t;
+
+// reference model: the key of every live id, and the live ids in a dense array for random picks
+static uint64_t ref_key[MAX_IDS];
+static PriorityQueueHandle_t ref_handle[MAX_IDS];
+static uint32_t live_ids[MAX_IDS];
+static uint32_t live_index[MAX_IDS];
+static size_t live_count;
+static uint32_t next_id;
+static uint64_t rng_state = 1;
+
+static uint64_t next_random(void)
+{
+    rng_state = jester_hash_u64(rng_state + 0x9E3779B97F4A7C15ULL);
+    return rng_state;
+}
+
+static bool item_less(const void* a, const void* b)
+{
+    return ((const TestItem_t*)a)->key < ((const TestItem_t*)b)->key;
+}
+
+static void ref_add(const uint32_t id, const uint64_t key)
+{
+    ref_key[id]            = key;
+    live_index[id]         = (uint32_t)live_count;
+    live_ids[live_count++] = id;
+}
+
+static void ref_drop(const uint32_t id)
+{
+    const uint32_t moved = live_ids[--live_count];
+    live_ids[live_index[id]] = moved;
+    live_index[moved]        = live_index[id];
+}
+
+static uint64_t ref_min_key(void)
+{
+    uint64_t min = UINT64_MAX;
+    for (size_t i = 0; i < live_count; i++)
+    {
+        if (ref_key[live_ids[i]] < min) min = ref_key[live_ids[i]];
+    }
+    return min;
+}
+
+// the popped or removed element must be a live id carrying the key the model has for it
+static bool ref_take(const TestItem_t* item)
+{
+    if (item->id >= next_id || live_ids[live_index[item->id]] != item->id || ref_key[item->id] != item->key)
+    {
+        return false;
+    }
+    ref_drop(item->id);
+    return true;
+}
+
+static bool pop_matches_model(PriorityQueue_t* queue)
+{
+    const uint64_t expected = ref_min_key();
+    TestItem_t item;
+    return pop_priority_queue(queue, &item) && item.key == expected && ref_take(&item);
+}
+
+// random push/pop/heapify/update/remove against a min-scan model
+static bool test_against_model(const size_t arity, const bool track_handles)
+{
+    PriorityQueue_t queue = create_priority_queue_custom(sizeof(TestItem_t), item_less, arity, track_handles, NULL);
+    live_count            = 0;
+    next_id               = 0;
+    bool ok               = true;
+
+    for (int op = 0; ok && op < OPERATIONS && next_id + BATCH_SIZE < MAX_IDS; op++)
+    {
+        const unsigned choice = (unsigned)(next_random() % 100);
+        if (choice < 30)
+        {
+            const TestItem_t item = {next_random() % KEY_RANGE, next_id++};
+            ok = push_priority_queue(&queue, &item, &ref_handle[item.id]);
+            ref_add(item.id, item.key);
+        }
+        else if (choice < 31)
+        {
+            TestItem_t batch[BATCH_SIZE];
+            PriorityQueueHandle_t handles[BATCH_SIZE];
+            for (size_t i = 0; i < BATCH_SIZE; i++) batch[i] = (TestItem_t){next_random() % KEY_RANGE, next_id++};
+
+            ok = heapify_priority_queue(&queue, batch, BATCH_SIZE, handles);
+            for (size_t i = 0; i < BATCH_SIZE; i++)
+            {
+                ref_add(batch[i].id, batch[i].key);
+                ref_handle[batch[i].id] = handles[i];
+            }
+        }
+        else if (choice < 75 || !track_handles)
+        {
+            ok = live_count ? pop_matches_model(&queue) : !pop_priority_queue(&queue, NULL);
+        }
+        else if (live_count && choice < 87)
+        {
+            // --- change the key in either direction ---
+            const uint32_t id     = live_ids[next_random() % live_count];
+            const TestItem_t item = {next_random() % KEY_RANGE, id};
+            ok                    = update_priority_queue(&queue, ref_handle[id], &item);
+            ref_key[id]           = item.key;
+        }
+        else if (live_count)
+        {
+            const uint32_t id = live_ids[next_random() % live_count];
+            TestItem_t removed;
+            ok = remove_priority_queue(&queue, ref_handle[id], &removed) && removed.id == id && ref_take(&removed);
+            ok = ok && !remove_priority_queue(&queue, ref_handle[id], NULL);  // released until the next push
+        }
+
+        // --- a random live handle must still lead to its element ---
+        if (ok && track_handles && live_count)
+        {
+            const uint32_t id       = live_ids[next_random() % live_count];
+            const TestItem_t* found = get_priority_queue_element(&queue, ref_handle[id]);
+            ok                      = found && found->id == id && found->key == ref_key[id];
+        }
+        ok = ok && get_priority_queue_count(&queue) == live_count;
+    }
+
+    while (ok && live_count) ok = pop_matches_model(&queue);
+    ok = ok && get_priority_queue_count(&queue) == 0;
+
+    free_priority_queue(&queue);
+    if (!ok) printf("priority-queue-test: arity %zu handles %d disagrees with the model\n", arity, track_handles);
+    return ok;
+}
+
+#define TEST_KEY_LESS(a, b) ((a) < (b))
+JESTER_DEFINE_PRIORITY_QUEUE(uint64_t, TEST_KEY_LESS, 2, TestBinaryQueue)
+JESTER_DEFINE_PRIORITY_QUEUE(uint64_t, TEST_KEY_LESS, 8, TestOctalQueue)
+
+// pushes and heapified batches in, then every pop must be at least the previous one
+#define TYPED_QUEUE_TEST(Name)                                                                                         \
+    static bool test_##Name(void)                                                                                      \
+    {                                                                                                                  \
+        Name##_t queue = create_##Name(0);                                                                             \
+        bool ok        = true;                                                                                         \
+        size_t pushed  = 0;                                                                                            \
+        for (int round = 0; ok && round < 100; round++)                                                                \
+        {                                                                                                              \
+            uint64_t batch[BATCH_SIZE];                                                                                \
+            for (size_t i = 0; i < BATCH_SIZE; i++) batch[i] = next_random() % KEY_RANGE;                              \
+            ok = heapify_##Name(&queue, batch, round % 7 ? BATCH_SIZE : 0);                                            \
+            pushed += round % 7 ? BATCH_SIZE : 0;                                                                      \
+            for (int i = 0; ok && i < 200; i++, pushed++) ok = push_##Name(&queue, next_random() % KEY_RANGE);         \
+        }                                                                                                              \
+        uint64_t previous = 0, key;                                                                                    \
+        size_t popped     = 0;                                                                                         \
+        while (ok && pop_##Name(&queue, &key))                                                                         \
+        {                                                                                                              \
+            ok       = key >= previous;                                                                                \
+            previous = key;                                                                                            \
+            popped++;                                                                                                  \
+        }                                                                                                              \
+        ok = ok && popped == pushed && peek_##Name(&queue) == NULL;                                                    \
+        free_##Name(&queue);                                                                                           \
+        if (!ok) puts("priority-queue-test: " #Name " popped out of order");                                           \
+        return ok;                                                                                                     \
+    }
+
+TYPED_QUEUE_TEST(TestBinaryQueue)
+TYPED_QUEUE_TEST(TestOctalQueue)
+
+int main()
+{
+    bool ok                = true;
+    const size_t arities[] = {2, 4, 8};
+    for (size_t i = 0; i < sizeof(arities) / sizeof(arities[0]); i++)
+    {
+        ok = test_against_model(arities[i], true) && ok;
+        ok = test_against_model(arities[i], false) && ok;
+    }
+    ok = test_TestBinaryQueue() && ok;
+    ok = test_TestOctalQueue() && ok;
+
+    puts(ok ? "priority-queue-test: passed" : "priority-queue-test: FAILED");
+    return ok ? 0 : 1;
+}
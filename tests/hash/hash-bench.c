@@ -0,0 +1,51 @@
+﻿#include "jester/hash/jester-hash.h"
+#include "jester/time/jester-time.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define BENCH_LONG_SIZE   (1 << 20)
+#define BENCH_LONG_ROUNDS 2000
+#define BENCH_KEY_SIZE    16
+#define BENCH_KEY_ROUNDS  20000000
+
+static const JesterHashKernel_t kernels[] = {JESTER_HASH_KERNEL_SCALAR, JESTER_HASH_KERNEL_SSE2, JESTER_HASH_KERNEL_AVX2};
+static const char* const kernel_names[]   = {"scalar", "sse2", "avx2"};
+
+// throughput of jester_hash on 1 MiB inputs per long-input kernel, plus the latency of a map-sized 16-byte key
+int main()
+{
+    unsigned char* data = malloc(BENCH_LONG_SIZE);
+    if (!data) return 1;
+    for (size_t i = 0; i < BENCH_LONG_SIZE; i++) data[i] = (unsigned char)jester_hash_u64(i);
+
+    uint64_t checksum = 0;
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++)
+    {
+        if (!jester_hash_set_kernel(kernels[k]))
+        {
+            printf("hash-bench: %s kernel not available\n", kernel_names[k]);
+            continue;
+        }
+
+        const uint64_t start = jester_now_ns();
+        for (int round = 0; round < BENCH_LONG_ROUNDS; round++) checksum += jester_hash(data, BENCH_LONG_SIZE, round);
+        const double seconds = (double)(jester_now_ns() - start) / 1e9;
+
+        printf("hash-bench: %s, 1 MiB inputs, %.1f GB/s\n", kernel_names[k],
+               (double)BENCH_LONG_SIZE * BENCH_LONG_ROUNDS / seconds / 1e9);
+    }
+    jester_hash_set_kernel(JESTER_HASH_KERNEL_AUTO);
+
+    const uint64_t start = jester_now_ns();
+    for (uint64_t round = 0; round < BENCH_KEY_ROUNDS; round++)
+    {
+        checksum += jester_hash(data + (round & 1023), BENCH_KEY_SIZE, checksum);
+    }
+    printf("hash-bench: %d-byte keys, %.1f ns/hash (checksum %llu)\n", BENCH_KEY_SIZE,
+           (double)(jester_now_ns() - start) / BENCH_KEY_ROUNDS, (unsigned long long)checksum);
+
+    free(data);
+    jester_time_shutdown();
+    return 0;
+}
@@ -0,0 +1,182 @@
+﻿#include "jester/hash/jester-hash.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define MAX_SPLIT_LENGTH 3000
+#define LONG_LENGTH      ((1 << 20) + 37)
+
+static const JesterHashKernel_t kernels[] = {JESTER_HASH_KERNEL_SCALAR, JESTER_HASH_KERNEL_SSE2, JESTER_HASH_KERNEL_AVX2};
+static const char* const kernel_names[]   = {"scalar", "sse2", "avx2"};
+static const uint64_t seeds[]             = {0, 0x9E3779B97F4A7C15ULL};
+
+#define KERNEL_COUNT (sizeof(kernels) / sizeof(kernels[0]))
+#define SEED_COUNT   (sizeof(seeds) / sizeof(seeds[0]))
+
+typedef struct KnownAnswer
+{
+    size_t size;
+    uint64_t hash[SEED_COUNT];
+} KnownAnswer_t;
+
+// jester_hash of the first size bytes of known_answer_input(), per seed; covers every length class and its edges
+static const KnownAnswer_t known_answers[] = {
+    {0, {0x1abadf5e1e20c5fdULL, 0x020fdd91041acfa6ULL}},    {1, {0xc92cec55969b292fULL, 0x7b5e6b7d93b30771ULL}},
+    {3, {0x27917a041c7c83b4ULL, 0xb855143bde363f3bULL}},    {4, {0x1b7d4414071db97cULL, 0x9ae404fa6be9e03bULL}},
+    {8, {0x2cd854be9b45ff34ULL, 0x749855a5892cc3c6ULL}},    {9, {0x3595920351cb7d20ULL, 0xbece7e5d7daa5fdaULL}},
+    {16, {0x8567b0f0e858a498ULL, 0xa174e822f7320786ULL}},   {17, {0x2112a65dc99ab6ceULL, 0x02b4d8d0e5703ef7ULL}},
+    {64, {0x8cef0e3d4b754c18ULL, 0x0efde62423fbc63fULL}},   {100, {0xe8e1742b60be4419ULL, 0xc717eb7e2f84ee7aULL}},
+    {128, {0xbd2b87926acfbddbULL, 0xd98c02e315f160a1ULL}},  {129, {0x36e51eb8e5b8e1f7ULL, 0xf9d1203ad1bcc345ULL}},
+    {200, {0x3e896d5499e1f22eULL, 0x00274a663136874aULL}},  {256, {0xfc2b4ccc0d1e2b84ULL, 0x871d6a0098f6d2a1ULL}},
+    {257, {0x9c232aec9ee56b9eULL, 0x2ea87fceca482bbaULL}},  {1024, {0x2081c87082b12e0dULL, 0x8ee823e9bd5e0dfaULL}},
+    {4096, {0x2647cd32938de00bULL, 0x94e93cb81cf784c2ULL}},
+};
+
+#define KNOWN_ANSWER_INPUT_SIZE 4096
+
+static uint64_t rng_state = 1;
+
+static uint64_t next_random(void)
+{
+    rng_state = jester_hash_u64(rng_state + 0x9E3779B97F4A7C15ULL);
+    return rng_state;
+}
+
+// hashes data fed in random-sized pieces, including empty ones and pieces that straddle the internal buffer
+static uint64_t hash_in_pieces(const unsigned char* data, const size_t size, const uint64_t seed)
+{
+    JesterHashState_t state;
+    jester_hash_init(&state, seed);
+
+    size_t fed = 0;
+    while (fed < size)
+    {
+        size_t piece = (size_t)(next_random() % 400);
+        if (piece > size - fed) piece = size - fed;
+
+        jester_hash_update(&state, data + fed, piece);
+        fed += piece;
+    }
+    return jester_hash_final(&state);
+}
+
+// fixed input for the known answers, independent of the hash under test
+static void known_answer_input(unsigned char* input)
+{
+    for (size_t i = 0; i < KNOWN_ANSWER_INPUT_SIZE; i++) input[i] = (unsigned char)(i * 131 + 7);
+}
+
+// the output itself must not change: maps and files may persist it
+static bool test_known_answers(void)
+{
+    static unsigned char input[KNOWN_ANSWER_INPUT_SIZE];
+    known_answer_input(input);
+
+    bool ok = true;
+    for (size_t i = 0; i < sizeof(known_answers) / sizeof(known_answers[0]); i++)
+    {
+        for (size_t s = 0; s < SEED_COUNT; s++)
+        {
+            const uint64_t hash = jester_hash(input, known_answers[i].size, seeds[s]);
+            if (hash == known_answers[i].hash[s]) continue;
+
+            printf("hash-test: size %zu seed %zu gave %016llx, expected %016llx\n", known_answers[i].size, s,
+                   (unsigned long long)hash, (unsigned long long)known_answers[i].hash[s]);
+            ok = false;
+        }
+    }
+
+    // --- the integer finalizer seeds the maps' hashing of scalar keys ---
+    if (jester_hash_u64(1) != 0x3c02aa47758292bdULL || jester_hash_u64(0x0123456789ABCDEFULL) != 0x6d97305f56288c62ULL)
+    {
+        puts("hash-test: jester_hash_u64 changed");
+        ok = false;
+    }
+    return ok;
+}
+
+// every kernel must hash every length class exactly like the scalar one
+static bool test_kernels_agree(const unsigned char* data, uint64_t* expected)
+{
+    bool ok = true;
+    for (size_t k = 0; k < KERNEL_COUNT; k++)
+    {
+        if (!jester_hash_set_kernel(kernels[k]))
+        {
+            printf("hash-test: %s kernel not available, skipped\n", kernel_names[k]);
+            continue;
+        }
+
+        size_t mismatches = 0;
+        for (size_t s = 0; s < SEED_COUNT; s++)
+        {
+            for (size_t size = 0; size <= MAX_SPLIT_LENGTH; size++)
+            {
+                const uint64_t hash = jester_hash(data, size, seeds[s]);
+                uint64_t* slot      = &expected[(s * (MAX_SPLIT_LENGTH + 2)) + size];
+                if (k == 0) *slot = hash;
+                else if (hash != *slot) mismatches++;
+            }
+
+            const uint64_t hash = jester_hash(data, LONG_LENGTH, seeds[s]);
+            uint64_t* slot      = &expected[(s * (MAX_SPLIT_LENGTH + 2)) + MAX_SPLIT_LENGTH + 1];
+            if (k == 0) *slot = hash;
+            else if (hash != *slot) mismatches++;
+        }
+
+        if (mismatches)
+        {
+            printf("hash-test: %s kernel differs from scalar on %zu inputs\n", kernel_names[k], mismatches);
+            ok = false;
+        }
+    }
+    jester_hash_set_kernel(JESTER_HASH_KERNEL_AUTO);
+    return ok;
+}
+
+// streaming must give the one-shot hash however the input is split
+static bool test_streaming_matches(const unsigned char* data, const uint64_t* expected)
+{
+    bool ok = true;
+    for (size_t k = 0; k < KERNEL_COUNT; k++)
+    {
+        if (!jester_hash_set_kernel(kernels[k])) continue;
+
+        size_t mismatches = 0;
+        for (size_t s = 0; s < SEED_COUNT; s++)
+        {
+            for (size_t size = 0; size <= MAX_SPLIT_LENGTH; size++)
+            {
+                const uint64_t wanted = expected[(s * (MAX_SPLIT_LENGTH + 2)) + size];
+                if (hash_in_pieces(data, size, seeds[s]) != wanted) mismatches++;
+            }
+        }
+
+        if (mismatches)
+        {
+            printf("hash-test: %s streaming differs from one-shot on %zu inputs\n", kernel_names[k], mismatches);
+            ok = false;
+        }
+    }
+    jester_hash_set_kernel(JESTER_HASH_KERNEL_AUTO);
+    return ok;
+}
+
+int main()
+{
+    unsigned char* data = malloc(LONG_LENGTH);
+    uint64_t* expected  = malloc(SEED_COUNT * (MAX_SPLIT_LENGTH + 2) * sizeof(uint64_t));
+    if (!data || !expected) return 1;
+
+    for (size_t i = 0; i < LONG_LENGTH; i++) data[i] = (unsigned char)next_random();
+
+    bool ok = test_known_answers();
+    ok      = test_kernels_agree(data, expected) && ok;
+    ok      = test_streaming_matches(data, expected) && ok;
+
+    free(data);
+    free(expected);
+    puts(ok ? "hash-test: passed" : "hash-test: FAILED");
+    return ok ? 0 : 1;
+}
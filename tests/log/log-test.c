@@ -1,11 +1,142 @@
 ﻿#include "jester/jester.h"
+#include "jester/log/jester-log-compress.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#define CRASH_TEST_FILE "log-test-crash.jlz"
+
+// fills buffer with lines that do not compress away to almost nothing, returns the byte count
+static size_t make_session_lines(char* buffer, const size_t capacity, const char tag)
+{
+    size_t size    = 0;
+    uint64_t state = (uint64_t)tag;
+    for (int i = 0; i < 200; i++)
+    {
+        state = jester_hash_u64(state);
+        size += (size_t)snprintf(buffer + size, capacity - size, "%c %d %016llx\n", tag, i, (unsigned long long)state);
+    }
+    return size;
+}
+
+// drops the writer like a killed process would: no index, no footer
+static void abandon_writer(LogCompressedFile_t* writer, FILE* file)
+{
+    free(writer->raw);
+    free(writer->packed);
+    free_dynamic_array(&writer->index);
+    free(writer);
+    fclose(file);
+}
+
+// decompresses the crash test file and compares it against the expected bytes
+static bool crash_file_holds(const char* expected, const size_t size)
+{
+    FILE* in  = fopen(CRASH_TEST_FILE, "rb");
+    FILE* out = tmpfile();
+    bool ok   = in && out && log_decompress_file(in, out);
+
+    static char actual[16384];
+    if (ok)
+    {
+        rewind(out);
+        ok = fread(actual, 1, sizeof(actual), out) == size && memcmp(actual, expected, size) == 0;
+    }
+    if (in) fclose(in);
+    if (out) fclose(out);
+    return ok;
+}
+
+// session 1 crashes mid-block, session 2 crashes after a flush, session 3 must still open and read everything
+static bool test_compressed_double_crash(void)
+{
+    static char a[8192], b[8192], c[8192], expected[16384];
+    const size_t a_size = make_session_lines(a, sizeof(a), 'A');
+    const size_t b_size = make_session_lines(b, sizeof(b), 'B');
+    const size_t c_size = make_session_lines(c, sizeof(c), 'C');
+    remove(CRASH_TEST_FILE);
+
+    // --- session 1: one intact block, then a block torn halfway through its payload ---
+    FILE* file                  = fopen(CRASH_TEST_FILE, "a+b");
+    LogCompressedFile_t* writer = file ? log_compressed_open(file) : NULL;
+    if (!writer) return false;
+    log_compressed_write(writer, a, a_size);
+    log_compressed_flush(writer);
+    const off_t intact_end = ftello(file);
+    log_compressed_write(writer, b, b_size);
+    log_compressed_flush(writer);
+    if (ftruncate(fileno(file), intact_end + ((ftello(file) - intact_end) / 2)) != 0) return false;
+    abandon_writer(writer, file);
+
+    // --- session 2: appends a block, then crashes before closing ---
+    file   = fopen(CRASH_TEST_FILE, "a+b");
+    writer = file ? log_compressed_open(file) : NULL;
+    if (!writer) return false;
+    log_compressed_write(writer, c, c_size);
+    log_compressed_flush(writer);
+    abandon_writer(writer, file);
+
+    memcpy(expected, a, a_size);
+    memcpy(expected + a_size, c, c_size);
+    if (!crash_file_holds(expected, a_size + c_size)) return false;
+
+    // --- session 3: must open, and its index must cover both earlier sessions ---
+    file   = fopen(CRASH_TEST_FILE, "a+b");
+    writer = file ? log_compressed_open(file) : NULL;
+    if (!writer) return false;
+    const bool closed = log_compressed_close(writer);
+    fclose(file);
+
+    const bool ok = closed && crash_file_holds(expected, a_size + c_size);
+    remove(CRASH_TEST_FILE);
+    return ok;
+}
+
+// rules resolve per file, and every change must invalidate levels that call sites already cached
+static bool test_module_levels(void)
+{
+    static LogSite_t site;
+    const char* other = "other/module.c";
+
+    // --- only this file's module stays at DEBUG, everything else is raised to WARN ---
+    bool ok = log_set_module_levels("*=WARN,log-test=DEBUG");
+    ok      = ok && log_level_for_file(__FILE__) == DEBUG && log_level_for_file(other) == WARNING;
+    ok      = ok && log_site_enabled(&site, other, WARNING) && !log_site_enabled(&site, other, INFO);
+
+    // --- prefixes match whole path components, and the longest one wins ---
+    ok = ok && log_set_module_levels("other/module=INFO,other=ERROR");
+    ok = ok && log_level_for_file(other) == INFO && log_level_for_file("another/module.c") == WARNING;
+    ok = ok && log_level_for_file("src/other/x.c") == ERROR;
+
+    // --- the site cached WARN above; the generation bump makes it re-resolve to INFO ---
+    ok = ok && log_site_enabled(&site, other, INFO) && !log_site_enabled(&site, other, DEBUG);
+
+    log_clear_module_levels();
+    ok = ok && log_level_for_file(__FILE__) == WARNING && !log_site_enabled(&site, other, INFO);
+
+    set_min_log_level(DEBUG);
+    ok = ok && log_level_for_file(other) == DEBUG && log_site_enabled(&site, other, DEBUG);
+
+    if (!ok) fprintf(stderr, "module level filtering test FAILED\n");
+    return ok;
+}
 
 int main()
 {
+    if (!test_compressed_double_crash())
+    {
+        fprintf(stderr, "compressed log double-crash test FAILED\n");
+        return 1;
+    }
+
     const int player_xp = 50;
 
     LOG_INIT_DEFAULT();
 
+    trace_enable(true);
+    JESTER_TRACE_SCOPE("main");
+
     set_min_log_level(DEBUG);
 
     toggle_file(true);
@@ -24,5 +155,20 @@ int main()
     LOG_ERROR("player_xp = %d", player_xp);
     LOG_FATAL("player_xp = %d", player_xp);
 
+    if (!test_module_levels()) return 1;
+
+    // a second instance with its own queues, file and writer thread
+    const LogConfig_t audit_cfg = {.file_enabled = true, .min_log_level = INFO, .file_name = "audit_%m-%d-%Y.txt"};
+    JesterLogger_t* audit = logger_create(&audit_cfg);
+    LOGGER_INFO(audit, "player_xp = %d", player_xp);
+    logger_destroy(audit);
+
+    JESTER_TRACE_BEGIN("shutdown");
+    LOG_SHUTDOWN();
+    JESTER_TRACE_END("shutdown");
+
+    trace_export_json("log-test-trace.json");
+    trace_shutdown();
+
     return 0;
 }
@@ -0,0 +1,131 @@
+﻿#include "jester/log/jester-log.h"
+#include "jester/log/jester-trace.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#define THREADS          40
+#define SPANS_PER_THREAD 10
+#define STREAM_FILE      "trace-test.json"
+
+static void* record_spans(void* arg)
+{
+    for (int i = 0; i < SPANS_PER_THREAD; i++)
+    {
+        JESTER_TRACE_SCOPE("span");
+    }
+
+    // --- exported before exit: nothing is pending, so the exit itself frees the buffer ---
+    if (arg) trace_write_json((FILE*)arg);
+    return NULL;
+}
+
+// one buffer plus one event, so the thread fills a buffer (and wakes the backend) before it exits
+static void* fill_buffer(void* arg)
+{
+    (void)arg;
+    for (int i = 0; i <= TRACE_BUFFER_EVENTS; i++) trace_begin("fill");
+    return NULL;
+}
+
+static bool run_threads(void* (*body)(void*), void* arg, const int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, body, arg) != 0) return false;
+        pthread_join(thread, NULL);
+    }
+    return true;
+}
+
+// counts the events written to the trace stream so far, and whether it has been closed
+static long count_stream_events(bool* closed)
+{
+    FILE* in = fopen(STREAM_FILE, "r");
+    if (!in) return -1;
+
+    char line[256];
+    long events = 0;
+    *closed     = false;
+    while (fgets(line, sizeof(line), in))
+    {
+        if (strstr(line, "\"ph\":")) events++;
+        *closed = strcmp(line, "]}\n") == 0;
+    }
+    fclose(in);
+    return events;
+}
+
+// threads that come and go must not leave their partial buffers behind
+static bool test_exited_threads_release(void)
+{
+    FILE* sink = tmpfile();
+    if (!sink) return false;
+
+    bool ok = run_threads(record_spans, sink, THREADS) && trace_buffer_count() == 0;
+    if (!ok) puts("trace-test: an exported thread kept its buffer after exit");
+
+    // --- unexported events outlive their thread until the next export ---
+    ok = ok && run_threads(record_spans, NULL, THREADS) && trace_buffer_count() == THREADS;
+    ok = ok && trace_write_json(sink) && trace_buffer_count() == 0;
+    if (!ok) puts("trace-test: retired buffers were not released by the export");
+
+    fclose(sink);
+    return ok;
+}
+
+// the default logger's backend streams every event without a manual export
+static bool test_backend_streams(void)
+{
+    const LogConfig_t cfg = {.min_log_level = INFO};
+    if (!log_init(&cfg) || !trace_open_stream(STREAM_FILE)) return false;
+
+    bool ok = run_threads(record_spans, NULL, THREADS) && run_threads(fill_buffer, NULL, 1);
+
+    // --- every exit asked the backend to drain, so the buffers go away without a flush ---
+    for (int wait = 0; ok && trace_buffer_count() != 0 && wait < 2000; wait++) usleep(1000);
+    ok = ok && trace_buffer_count() == 0;
+    if (!ok) puts("trace-test: the backend did not drain the buffers of exited threads");
+
+    // --- a live thread's events only reach the stream through log_flush() ---
+    record_spans(NULL);
+    log_flush();
+
+    bool closed;
+    const long expected = (long)(THREADS + 1) * SPANS_PER_THREAD * 2 + TRACE_BUFFER_EVENTS + 1;
+    long events         = count_stream_events(&closed);
+    if (events != expected || closed)
+    {
+        printf("trace-test: %ld events streamed by log_flush(), expected %ld\n", events, expected);
+        ok = false;
+    }
+
+    // --- trace_shutdown() writes what is left and closes the document ---
+    JESTER_TRACE_BEGIN("after-flush");
+    log_shutdown();
+    trace_shutdown();
+
+    events = count_stream_events(&closed);
+    if (events != expected + 1 || !closed)
+    {
+        printf("trace-test: stream holds %ld events (%s), expected %ld\n", events, closed ? "closed" : "open",
+               expected + 1);
+        ok = false;
+    }
+    remove(STREAM_FILE);
+    return ok;
+}
+
+int main()
+{
+    trace_enable(true);
+
+    bool ok = test_exited_threads_release();
+    ok      = test_backend_streams() && ok;
+
+    puts(ok ? "trace-test: passed" : "trace-test: FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,169 @@
+﻿#include "jester/datastructs/array/jester-dynamic-array.h"
+#include "jester/memory/jester-arena.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define SMALL_CHUNK 256
+
+// a mark taken in one chunk must hand the same addresses out again after allocations that spilled into others
+static bool test_rewind_across_chunks(void)
+{
+    Arena_t arena = create_arena(SMALL_CHUNK);
+    void* kept    = allocate_arena(&arena, 100);
+    memset(kept, 0xAB, 100);
+
+    const ArenaMark_t mark = mark_arena(&arena);
+    void* first_pass[6];
+    for (int i = 0; i < 6; i++) first_pass[i] = allocate_arena(&arena, 100);
+
+    rewind_arena(&arena, mark);
+    bool ok = true;
+    for (int i = 0; i < 6; i++) ok = ok && allocate_arena(&arena, 100) == first_pass[i];  // retained chunks reused
+
+    const unsigned char* bytes = kept;
+    for (int i = 0; i < 100; i++) ok = ok && bytes[i] == 0xAB;
+
+    free_arena(&arena);
+    if (!ok) puts("arena-test: rewind across chunks did not reuse the same memory");
+    return ok;
+}
+
+// alignments above the default, including one larger than a whole chunk
+static bool test_overaligned(void)
+{
+    Arena_t arena = create_arena(SMALL_CHUNK);
+    bool ok       = allocate_arena_aligned(&arena, 8, 3) == NULL && allocate_arena_aligned(&arena, 8, 0) == NULL;
+
+    const size_t alignments[] = {32, 64, 256, 4096};
+    for (int round = 0; round < 4; round++)
+    {
+        for (size_t i = 0; i < sizeof(alignments) / sizeof(alignments[0]); i++)
+        {
+            allocate_arena(&arena, 24);  // knock the bump pointer off alignment
+            unsigned char* block = allocate_arena_aligned(&arena, 40, alignments[i]);
+            ok                   = ok && block && ((uintptr_t)block & (alignments[i] - 1)) == 0;
+            if (block) memset(block, 0xCD, 40);
+        }
+    }
+
+    free_arena(&arena);
+    if (!ok) puts("arena-test: over-aligned allocation was misaligned");
+    return ok;
+}
+
+// a request larger than the chunk size gets a chunk of its own and leaves earlier blocks intact
+static bool test_oversized_request(void)
+{
+    Arena_t arena        = create_arena(SMALL_CHUNK);
+    unsigned char* small = allocate_arena(&arena, 64);
+    memset(small, 0x11, 64);
+
+    unsigned char* large = allocate_arena(&arena, 10000);
+    bool ok              = large != NULL;
+    if (large) memset(large, 0x22, 10000);
+
+    unsigned char* after = allocate_arena(&arena, 64);
+    ok                   = ok && after != NULL;
+    if (after) memset(after, 0x33, 64);
+
+    for (int i = 0; ok && i < 64; i++) ok = small[i] == 0x11 && after[i] == 0x33;
+    for (int i = 0; ok && i < 10000; i++) ok = large[i] == 0x22;
+
+    free_arena(&arena);
+    if (!ok) puts("arena-test: oversized request overlapped other blocks");
+    return ok;
+}
+
+// a fixed buffer hands out memory from inside itself only, fails once full, and is reusable after a reset
+static bool test_buffer_exhaustion(void)
+{
+    static unsigned char buffer[1024];
+    Arena_t arena = create_arena_from_buffer(buffer + 1, sizeof(buffer) - 1);  // deliberately misaligned start
+
+    size_t blocks = 0;
+    void* first   = NULL;
+    bool ok       = true;
+    for (unsigned char* block; (block = allocate_arena(&arena, 64)) != NULL; blocks++)
+    {
+        if (first == NULL) first = block;
+        ok = ok && block >= buffer + 1 && block + 64 <= buffer + sizeof(buffer);
+    }
+    ok = ok && blocks >= 12 && blocks <= 15;  // 1023 bytes minus the chunk header and padding
+
+    reset_arena(&arena);
+    ok = ok && allocate_arena(&arena, 64) == first;
+    ok = ok && !free_arena(&arena);  // nothing was allocated from the heap
+
+    Arena_t tiny = create_arena_from_buffer(buffer, 8);
+    ok           = ok && allocate_arena(&tiny, 1) == NULL;
+
+    if (!ok) puts("arena-test: buffer arena handed out memory outside the buffer or never filled up");
+    return ok;
+}
+
+static bool holds_sequence(const DynamicArray_t* array, const uint32_t start, const uint32_t count)
+{
+    if (array->count != count) return false;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (*(uint32_t*)get_dynamic_array_element(array, i) != start + i) return false;
+    }
+    return true;
+}
+
+// a DynamicArray_t on an arena grows the top allocation in place and survives rewind and reset cycles
+static bool test_dynamic_array_on_arena(void)
+{
+    Arena_t arena                  = create_arena(0);
+    const JesterAllocator_t* alloc = get_arena_allocator(&arena);
+    void* const chunk_start        = allocate_arena(&arena, 8);  // the array does not start at the chunk's first byte
+
+    const ArenaMark_t mark = mark_arena(&arena);
+    DynamicArray_t array   = create_dynamic_array_with_allocator(sizeof(uint32_t), 4, alloc);
+    void* const start      = array.data;
+
+    // --- while the array is the top allocation and fits in the chunk, growth never moves it ---
+    bool ok = true;
+    for (uint32_t i = 0; i < 4096; i++) ok = ok && push_dynamic_array(&array, &i);
+    ok = ok && array.data == start && holds_sequence(&array, 0, 4096);
+
+    // --- past the chunk it moves to a new one, keeping its contents ---
+    for (uint32_t i = 4096; i < 100000; i++) ok = ok && push_dynamic_array(&array, &i);
+    ok = ok && holds_sequence(&array, 0, 100000);
+
+    // --- rewinding drops it; a new array reuses the same memory ---
+    rewind_arena(&arena, mark);
+    DynamicArray_t second = create_dynamic_array_with_allocator(sizeof(uint32_t), 4, alloc);
+    ok                    = ok && second.data == start;
+    for (uint32_t i = 0; i < 50000; i++)
+    {
+        const uint32_t value = 7 + i;
+        ok                   = ok && push_dynamic_array(&second, &value);
+    }
+    ok = ok && holds_sequence(&second, 7, 50000);
+
+    // --- after a reset the first chunk is reused from its first byte ---
+    reset_arena(&arena);
+    DynamicArray_t third = create_dynamic_array_with_allocator(sizeof(uint32_t), 4, alloc);
+    ok                   = ok && third.data == chunk_start;
+    for (uint32_t i = 0; i < 1000; i++) ok = ok && push_dynamic_array(&third, &i);
+    ok = ok && holds_sequence(&third, 0, 1000);
+
+    free_arena(&arena);
+    if (!ok) puts("arena-test: DynamicArray_t on an arena lost data or did not grow in place");
+    return ok;
+}
+
+int main()
+{
+    bool ok = test_rewind_across_chunks();
+    ok      = test_overaligned() && ok;
+    ok      = test_oversized_request() && ok;
+    ok      = test_buffer_exhaustion() && ok;
+    ok      = test_dynamic_array_on_arena() && ok;
+
+    puts(ok ? "arena-test: passed" : "arena-test: FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,118 @@
+﻿#include "jester/memory/jester-pool.h"
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define WAVES            8
+#define THREADS_PER_WAVE 96  // more than JESTER_POOL_MAX_THREAD_CACHES, so some threads borrow a slot
+#define ROUNDS           2000
+#define LIVE_BLOCKS      100
+
+static Pool_t pool;
+
+// allocates and frees in bursts larger than a magazine, stamping every block to catch double hand-outs
+static void* churn(void* argument)
+{
+    const uintptr_t stamp = (uintptr_t)argument;
+    void* live[LIVE_BLOCKS];
+    bool ok = true;
+
+    for (int round = 0; round < ROUNDS / LIVE_BLOCKS; round++)
+    {
+        for (int i = 0; i < LIVE_BLOCKS; i++)
+        {
+            live[i] = allocate_pool_block(&pool);
+            if (live[i] == NULL) return NULL;
+            *(uintptr_t*)live[i] = stamp;
+        }
+        for (int i = 0; i < LIVE_BLOCKS; i++)
+        {
+            ok = ok && *(uintptr_t*)live[i] == stamp;
+            free_pool_block(&pool, live[i]);
+        }
+    }
+
+    // --- exit holding a partly filled magazine so the key destructor has something to return ---
+    free_pool_block(&pool, allocate_pool_block(&pool));
+    return ok ? argument : NULL;
+}
+
+// free blocks on the shared list plus those parked in magazines
+static size_t free_block_count(void)
+{
+    size_t count = 0;
+    for (void* block = pool.free_list; block; block = *(void**)block) count++;
+    for (size_t i = 0; i < JESTER_POOL_MAX_THREAD_CACHES; i++) count += pool.caches[i].count;
+    return count;
+}
+
+static size_t slab_count(void)
+{
+    size_t count = 0;
+    for (void* slab = pool.slabs; slab; slab = *(void**)slab) count++;  // a slab starts with its next pointer
+    return count;
+}
+
+// waves of threads that exit: every slot must be released and no block may go missing
+static bool test_thread_exit_recycles_slots(void)
+{
+    pool    = create_pool(48, 64);
+    bool ok = pool.caches != NULL;
+
+    for (int wave = 0; ok && wave < WAVES; wave++)
+    {
+        pthread_t threads[THREADS_PER_WAVE];
+        for (uintptr_t t = 0; t < THREADS_PER_WAVE; t++)
+        {
+            pthread_create(&threads[t], NULL, churn, (void*)(wave * THREADS_PER_WAVE + t + 1));
+        }
+        for (int t = 0; t < THREADS_PER_WAVE; t++)
+        {
+            void* result;
+            pthread_join(threads[t], &result);
+            ok = ok && result != NULL;
+        }
+    }
+
+    for (size_t i = 0; ok && i < JESTER_POOL_MAX_THREAD_CACHES; i++)
+    {
+        ok = !atomic_load(&pool.caches[i].owned);
+    }
+    ok = ok && free_block_count() == slab_count() * pool.blocks_per_slab;
+
+    free_pool(&pool);
+    if (!ok) puts("pool-test: thread exit left blocks or slots behind");
+    return ok;
+}
+
+static void* refuse_allocate(void* context, const size_t size)
+{
+    (void)context;
+    (void)size;
+    return NULL;
+}
+
+// a pool whose caches could not be allocated must reject every call without crashing
+static bool test_failed_create(void)
+{
+    const JesterAllocator_t refusing = {refuse_allocate, NULL, NULL, NULL};
+    Pool_t failed                    = create_pool_with_allocator(32, 0, &refusing);
+
+    uint64_t outside = 0;
+    free_pool_block(&failed, &outside);
+    const bool ok = failed.caches == NULL && allocate_pool_block(&failed) == NULL;
+
+    free_pool(&failed);
+    if (!ok) puts("pool-test: failed create_pool did not reject calls");
+    return ok;
+}
+
+int main()
+{
+    bool ok = test_thread_exit_recycles_slots();
+    ok      = test_failed_create() && ok;
+
+    puts(ok ? "pool-test: passed" : "pool-test: FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,87 @@
+﻿#include "jester/string/jester-intern.h"
+#include "jester/hash/jester-hash.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#define THREADS 4
+#define STRINGS 20000
+
+static InternPool_t pool;
+static InternId_t ids[THREADS][STRINGS];
+static atomic_bool failed;
+
+static void make_name(char* name, const size_t capacity, const size_t index)
+{
+    snprintf(name, capacity, "interned-%zu", index);
+}
+
+// interns every name in its own random order while checking ids other threads already published
+static void* intern_all(void* argument)
+{
+    const size_t thread = (uintptr_t)argument;
+    uint64_t state      = thread + 1;
+    char name[32];
+
+    for (size_t n = 0; n < STRINGS; n++)
+    {
+        const size_t index = (size_t)((n * 7919 + thread * 104729) % STRINGS);  // 7919 is coprime to STRINGS
+        make_name(name, sizeof(name), index);
+        ids[thread][index] = intern_cstr(&pool, name);
+
+        // --- any published id must resolve to a terminated string that maps back to it ---
+        state                = jester_hash_u64(state);
+        const size_t count   = get_intern_pool_count(&pool);
+        const InternId_t id  = (InternId_t)(state % count);
+        const StringView_t v = get_intern_view(&pool, id);
+        if (v.data[v.size] != '\0' || strlen(v.data) != v.size || find_intern_string(&pool, v) != id)
+        {
+            atomic_store(&failed, true);
+        }
+    }
+    return NULL;
+}
+
+static bool test_concurrent_intern(void)
+{
+    pool = create_intern_pool();
+
+    // --- a pointer taken before the other threads start must survive all their growth ---
+    const InternId_t first  = intern_cstr(&pool, "interned-0");
+    const char* first_bytes = get_intern_string(&pool, first);
+
+    pthread_t threads[THREADS];
+    for (uintptr_t t = 0; t < THREADS; t++) pthread_create(&threads[t], NULL, intern_all, (void*)t);
+    for (int t = 0; t < THREADS; t++) pthread_join(threads[t], NULL);
+
+    bool ok = !atomic_load(&failed) && get_intern_pool_count(&pool) == STRINGS;
+    ok      = ok && get_intern_string(&pool, first) == first_bytes && ids[0][0] == first;
+
+    // --- every thread got the same id per string, and the ids are exactly 0 .. STRINGS - 1 ---
+    static bool seen[STRINGS];
+    char name[32];
+    for (size_t index = 0; ok && index < STRINGS; index++)
+    {
+        const InternId_t id = ids[0][index];
+        for (int t = 1; t < THREADS; t++) ok = ok && ids[t][index] == id;
+
+        make_name(name, sizeof(name), index);
+        ok       = ok && id < STRINGS && !seen[id] && strcmp(get_intern_string(&pool, id), name) == 0;
+        seen[id] = true;
+    }
+
+    ok = ok && get_intern_string(&pool, STRINGS) == NULL && get_intern_view(&pool, STRINGS).size == 0;
+    free_intern_pool(&pool);
+
+    if (!ok) puts("intern-test: concurrent interning gave inconsistent ids or strings");
+    return ok;
+}
+
+int main()
+{
+    const bool ok = test_concurrent_intern();
+
+    puts(ok ? "intern-test: passed" : "intern-test: FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,122 @@
+﻿#include "jester/string/jester-string.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// checks contents, size, terminator and storage mode in one go
+static bool string_is(const String_t* string, const char* expected, const bool inline_storage)
+{
+    const size_t size = strlen(expected);
+    return get_string_size(string) == size && memcmp(get_string_data(string), expected, size + 1) == 0
+           && is_string_inline(string) == inline_storage;
+}
+
+// the last inline size is JESTER_STRING_INLINE_CAPACITY, one more byte moves the string to the heap
+static bool test_inline_boundary(void)
+{
+    char expected[64] = "";
+    String_t grown    = create_string("");
+    bool ok           = string_is(&grown, "", true);
+
+    for (size_t size = 1; ok && size <= 40; size++)
+    {
+        const char c       = (char)('a' + size % 26);
+        expected[size - 1] = c;
+        expected[size]     = '\0';
+
+        ok = append_string(&grown, (StringView_t){&c, 1}) && string_is(&grown, expected, size <= 23);
+    }
+    free_string(&grown);
+
+    String_t exact = create_string("12345678901234567890123");
+    String_t over  = create_string("123456789012345678901234");
+    ok             = ok && string_is(&exact, "12345678901234567890123", true);
+    ok             = ok && string_is(&over, "123456789012345678901234", false);
+    free_string(&exact);
+    free_string(&over);
+
+    if (!ok) puts("string-test: wrong contents or storage around the inline boundary");
+    return ok;
+}
+
+// appends 9 bytes of the string, from start, to itself and to expected
+static bool append_self_slice(String_t* string, char* expected, const size_t start)
+{
+    const StringView_t slice = slice_string_view(get_string_view(string), start, 9);
+    const size_t size        = strlen(expected);
+    memcpy(expected + size, expected + start, 9);
+    expected[size + 9] = '\0';
+    return append_string(string, slice) && string_is(string, expected, false);
+}
+
+// appending a view of the string itself, while the append moves it inline -> heap -> larger heap
+static bool test_self_append(void)
+{
+    String_t string = create_string("abc");
+    char expected[256];
+    strcpy(expected, "abc");
+    bool ok = true;
+
+    for (int round = 0; ok && round < 5; round++)
+    {
+        const size_t size = strlen(expected);
+        memcpy(expected + size, expected, size);
+        expected[2 * size] = '\0';
+
+        // --- 3, 6, 12 stay inline, 24 moves to the heap, 48 and 96 regrow it ---
+        ok = append_string(&string, get_string_view(&string)) && string_is(&string, expected, 2 * size <= 23);
+    }
+
+    free_string(&string);
+
+    // --- created at exactly 40 bytes of capacity, so the tail slice reallocates and the middle one does not ---
+    strcpy(expected, "0123456789abcdefghijklmnopqrstuvwxyzABCD");
+    string = create_string(expected);
+    ok     = ok && append_self_slice(&string, expected, 31);
+    ok     = ok && append_self_slice(&string, expected, 5);
+
+    free_string(&string);
+    if (!ok) puts("string-test: appending a string to itself corrupted it");
+    return ok;
+}
+
+// a format that overflows the room left makes the first vsnprintf truncate and forces a second pass
+static bool test_format_truncation(void)
+{
+    String_t string = create_string("id=");
+    bool ok         = append_string_format(&string, "%d", 42) && string_is(&string, "id=42", true);
+
+    // --- exactly fills the inline buffer: no second pass ---
+    ok = ok && append_string_format(&string, "%s", "abcdefghijklmnopqr")
+         && string_is(&string, "id=42abcdefghijklmnopqr", true);
+
+    // --- one byte over: truncated inline attempt, then heap ---
+    ok = ok && append_string_format(&string, "%c", '!') && string_is(&string, "id=42abcdefghijklmnopqr!", false);
+
+    // --- far over the heap capacity: truncated heap attempt, then regrow ---
+    char expected[512], long_arg[301];
+    memset(long_arg, 'z', 300);
+    long_arg[300] = '\0';
+    snprintf(expected, sizeof(expected), "id=42abcdefghijklmnopqr!<%s|%08x>", long_arg, 0xBEEFu);
+    ok = ok && append_string_format(&string, "<%s|%08x>", long_arg, 0xBEEFu) && string_is(&string, expected, false);
+
+    // --- an inline string whose first format attempt truncates ---
+    String_t small = create_string("x");
+    ok = ok && append_string_format(&small, "%s%s", "0123456789", "0123456789abcdef")
+         && string_is(&small, "x01234567890123456789abcdef", false);
+
+    free_string(&string);
+    free_string(&small);
+    if (!ok) puts("string-test: append_string_format lost or garbled output on its second pass");
+    return ok;
+}
+
+int main()
+{
+    bool ok = test_inline_boundary();
+    ok      = test_self_append() && ok;
+    ok      = test_format_truncation() && ok;
+
+    puts(ok ? "string-test: passed" : "string-test: FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,77 @@
+﻿#include "jester/time/jester-time.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <time.h>
+
+#define RESYNC_ROUNDS  100
+#define ROUND_SLEEP_NS 10000000L  // 10 ms between forced resyncs
+#define MAX_OFFSET_NS  100000     // how far jester_now_ns() may stray from CLOCK_MONOTONIC
+
+static atomic_bool reading;
+static atomic_bool went_backwards;
+
+static int64_t monotonic_offset_ns(void)
+{
+    struct timespec ts;
+    const uint64_t before = jester_now_ns();
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    const uint64_t after = jester_now_ns();
+
+    const uint64_t mono = (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+    return (int64_t)(before + (after - before) / 2 - mono);
+}
+
+// reads the clock back to back while the main thread re-anchors it
+static void* read_continuously(void* argument)
+{
+    (void)argument;
+    uint64_t previous = jester_now_ns();
+    while (atomic_load(&reading))
+    {
+        const uint64_t now = jester_now_ns();
+        if (now < previous) atomic_store(&went_backwards, true);
+        previous = now;
+    }
+    return NULL;
+}
+
+// forced resyncs must neither step the clock back nor let its error against CLOCK_MONOTONIC build up
+static bool test_resync_tracks_monotonic(void)
+{
+    jester_time_init();
+    atomic_store(&reading, true);
+    pthread_t reader;
+    pthread_create(&reader, NULL, read_continuously, NULL);
+
+    int64_t worst = 0;
+    for (int round = 0; round < RESYNC_ROUNDS; round++)
+    {
+        nanosleep(&(struct timespec){0, ROUND_SLEEP_NS}, NULL);
+
+        const uint64_t before = jester_now_ns();
+        jester_time_resync();
+        if (jester_now_ns() < before) atomic_store(&went_backwards, true);
+
+        const int64_t offset = monotonic_offset_ns();
+        if ((offset < 0 ? -offset : offset) > (worst < 0 ? -worst : worst)) worst = offset;
+    }
+
+    atomic_store(&reading, false);
+    pthread_join(reader, NULL);
+    jester_time_shutdown();
+
+    const bool ok = !atomic_load(&went_backwards) && worst < MAX_OFFSET_NS && worst > -MAX_OFFSET_NS;
+    printf("time-test: worst offset from CLOCK_MONOTONIC %lld ns%s\n", (long long)worst,
+           atomic_load(&went_backwards) ? ", clock went backwards" : "");
+    return ok;
+}
+
+int main()
+{
+    const bool ok = test_resync_tracks_monotonic();
+
+    puts(ok ? "time-test: passed" : "time-test: FAILED");
+    return ok ? 0 : 1;
+}